@@ -0,0 +1,362 @@
+#include "scheduler.h"
+#include "file_parser.h"
+#include "performance.h"
+#include "process_table.h"
+#include "workload_generator.h"
+#include <sys/resource.h>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <vector>
+#include <string>
+#include <map>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+// Scheduler throughput and scaling benchmarks
+//
+// Every algorithm from create_scheduler() is timed on generated workloads of
+// 10^2 .. --max-size processes, along with FileParser and PerformanceMetrics.
+// Results are printed as a table and can be written as CSV/JSON; passing a
+// previous CSV as --baseline flags cases that got slower than --tolerance.
+
+struct BenchResult {
+    std::string benchmark;
+    long long size;
+    double seconds;          // Mean wall time per repetition
+    int repetitions;
+    long peak_rss_kb;        // Process high-water mark after the case
+    
+    double ns_per_process() const { return seconds * 1e9 / size; }
+};
+
+struct BenchOptions {
+    long long min_size;
+    long long max_size;
+    double min_seconds;      // Repeat small cases until this much time is spent
+    std::vector<std::string> algorithms;
+    std::string csv_file;
+    std::string json_file;
+    std::string baseline_file;
+    double tolerance;
+    std::string scratch_file;
+    
+    BenchOptions()
+        : min_size(100), max_size(10000000), min_seconds(0.2),
+          algorithms(scheduler_names()), tolerance(0.10),
+          scratch_file("/tmp/scheduler_bench_workload.txt") {}
+};
+
+typedef std::chrono::steady_clock Clock;
+
+// Drops std::cout output (e.g. FCFS progress lines) while in scope
+struct QuietStdout {
+    std::streambuf* saved;
+    
+    QuietStdout() : saved(std::cout.rdbuf(nullptr)) {}
+    ~QuietStdout() {
+        std::cout.rdbuf(saved);
+        std::cout.clear();
+    }
+};
+
+long peak_rss_kb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;  // Kilobytes on Linux
+}
+
+double elapsed_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// About 90% CPU load: mean burst 10, mean inter-arrival 11.1
+WorkloadSpec bench_spec(long long size) {
+    WorkloadSpec spec;
+    spec.count = static_cast<size_t>(size);
+    spec.seed = 12345;
+    spec.arrival_rate = 0.09;
+    spec.burst_mean = 10.0;
+    return spec;
+}
+
+// Time `body` until min_seconds have elapsed (at least once); `setup` runs
+// untimed before each repetition
+template <typename Setup, typename Body>
+BenchResult measure(const std::string& name, long long size, double min_seconds,
+                    Setup setup, Body body) {
+    BenchResult result;
+    result.benchmark = name;
+    result.size = size;
+    result.repetitions = 0;
+    
+    double total = 0.0;
+    do {
+        setup();
+        Clock::time_point start = Clock::now();
+        body();
+        total += elapsed_since(start);
+        result.repetitions++;
+    } while (total < min_seconds);
+    
+    result.seconds = total / result.repetitions;
+    result.peak_rss_kb = peak_rss_kb();
+    return result;
+}
+
+void print_result(const BenchResult& r) {
+    std::cout << std::left << std::setw(30) << r.benchmark << std::right
+              << std::setw(10) << r.size
+              << std::setw(14) << std::fixed << std::setprecision(3) << r.seconds * 1000.0
+              << std::setw(14) << std::setprecision(1) << r.ns_per_process()
+              << std::setw(12) << r.peak_rss_kb
+              << std::setw(8) << r.repetitions << "\n";
+}
+
+void run_size(long long size, const BenchOptions& options, std::vector<BenchResult>& results) {
+    ProcessTable workload = WorkloadGenerator(bench_spec(size)).generate_table();
+    
+    // Schedulers: load untimed, time schedule() only
+    for (const std::string& algorithm : options.algorithms) {
+        std::unique_ptr<Scheduler> scheduler;
+        BenchResult result;
+        {
+            QuietStdout quiet;
+            result = measure("schedule/" + algorithm, size, options.min_seconds,
+                [&]() {
+                    scheduler.reset();
+                    scheduler.reset(create_scheduler(algorithm));
+                    scheduler->load_processes(workload);
+                },
+                [&]() { scheduler->schedule(); });
+        }
+        results.push_back(result);
+        print_result(result);
+    }
+    
+    // Metrics over a finished FCFS run
+    {
+        std::unique_ptr<Scheduler> scheduler(create_scheduler("fcfs"));
+        {
+            QuietStdout quiet;
+            scheduler->load_processes(workload);
+            scheduler->schedule();
+        }
+        MetricsSummary summary;
+        results.push_back(measure("metrics", size, options.min_seconds, []() {},
+            [&]() {
+                summary = PerformanceMetrics::view(scheduler->get_processes(),
+                                                   scheduler->get_gantt_chart()).summary();
+            }));
+        print_result(results.back());
+    }
+    
+    // Parsers over the same workload written as text
+    WorkloadGenerator::write_text(bench_spec(size), options.scratch_file);
+    workload.clear();
+    
+    std::vector<Process> parsed;
+    results.push_back(measure("parse/stream", size, options.min_seconds,
+        [&]() { std::vector<Process>().swap(parsed); },
+        [&]() { parsed = FileParser::parse_file(options.scratch_file); }));
+    print_result(results.back());
+    
+    results.push_back(measure("parse/fast", size, options.min_seconds,
+        [&]() { std::vector<Process>().swap(parsed); },
+        [&]() { parsed = FileParser::parse_file_fast(options.scratch_file); }));
+    print_result(results.back());
+    
+    std::remove(options.scratch_file.c_str());
+}
+
+// Least-squares slope of log(seconds) against log(size): 1.0 is linear,
+// 2.0 quadratic. Sizes below 1000 are dominated by fixed costs and skipped
+// when enough larger sizes exist.
+std::map<std::string, double> scaling_exponents(const std::vector<BenchResult>& results) {
+    std::map<std::string, std::vector<const BenchResult*> > by_benchmark;
+    for (const auto& r : results) {
+        by_benchmark[r.benchmark].push_back(&r);
+    }
+    
+    std::map<std::string, double> exponents;
+    for (const auto& entry : by_benchmark) {
+        std::vector<const BenchResult*> points;
+        for (const BenchResult* r : entry.second) {
+            if (r->size >= 1000) points.push_back(r);
+        }
+        if (points.size() < 2) points = entry.second;
+        if (points.size() < 2) continue;
+        
+        double sx = 0, sy = 0, sxx = 0, sxy = 0;
+        for (const BenchResult* r : points) {
+            double x = std::log(static_cast<double>(r->size));
+            double y = std::log(r->seconds);
+            sx += x; sy += y; sxx += x * x; sxy += x * y;
+        }
+        double n = static_cast<double>(points.size());
+        exponents[entry.first] = (n * sxy - sx * sy) / (n * sxx - sx * sx);
+    }
+    return exponents;
+}
+
+void write_csv(const std::string& filename, const std::vector<BenchResult>& results) {
+    std::ofstream out(filename.c_str());
+    out << "benchmark,size,seconds,ns_per_process,peak_rss_kb,repetitions\n";
+    out << std::setprecision(9);
+    for (const auto& r : results) {
+        out << r.benchmark << "," << r.size << "," << r.seconds << "," << r.ns_per_process()
+            << "," << r.peak_rss_kb << "," << r.repetitions << "\n";
+    }
+}
+
+void write_json(const std::string& filename, const std::vector<BenchResult>& results,
+                const std::map<std::string, double>& exponents) {
+    std::ofstream out(filename.c_str());
+    out << std::setprecision(9);
+    out << "{\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        out << "    {\"benchmark\": \"" << r.benchmark << "\", \"size\": " << r.size
+            << ", \"seconds\": " << r.seconds << ", \"ns_per_process\": " << r.ns_per_process()
+            << ", \"peak_rss_kb\": " << r.peak_rss_kb << ", \"repetitions\": " << r.repetitions
+            << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ],\n  \"scaling_exponents\": {\n";
+    size_t i = 0;
+    for (const auto& entry : exponents) {
+        out << "    \"" << entry.first << "\": " << entry.second
+            << (++i < exponents.size() ? "," : "") << "\n";
+    }
+    out << "  }\n}\n";
+}
+
+// Compare ns/process against a CSV written by an earlier run; returns the
+// number of regressions beyond the tolerance
+int compare_baseline(const std::string& filename, const std::vector<BenchResult>& results,
+                     double tolerance) {
+    std::ifstream in(filename.c_str());
+    if (!in.is_open()) {
+        std::cerr << "Error: Cannot open baseline " << filename << "\n";
+        return 1;
+    }
+    
+    std::map<std::pair<std::string, long long>, double> baseline;
+    std::string line;
+    std::getline(in, line);  // header
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        std::string name, size, seconds, ns;
+        if (std::getline(fields, name, ',') && std::getline(fields, size, ',') &&
+            std::getline(fields, seconds, ',') && std::getline(fields, ns, ',')) {
+            baseline[std::make_pair(name, std::atoll(size.c_str()))] = std::atof(ns.c_str());
+        }
+    }
+    
+    int regressions = 0;
+    std::cout << "\n=== Baseline Comparison (tolerance " << tolerance * 100.0 << "%) ===\n";
+    for (const auto& r : results) {
+        auto it = baseline.find(std::make_pair(r.benchmark, r.size));
+        if (it == baseline.end() || it->second <= 0.0) continue;
+        
+        double change = r.ns_per_process() / it->second - 1.0;
+        if (change > tolerance) {
+            regressions++;
+            std::cout << "REGRESSION " << r.benchmark << " n=" << r.size << ": "
+                      << std::setprecision(1) << it->second << " -> " << r.ns_per_process()
+                      << " ns/process (+" << change * 100.0 << "%)\n";
+        }
+    }
+    if (regressions == 0) {
+        std::cout << "No regressions\n";
+    }
+    return regressions;
+}
+
+void print_usage(const char* program_name) {
+    std::cout << "Usage: " << program_name << " [options]\n\n";
+    std::cout << "Options:\n";
+    std::cout << "  --max-size N      - Largest workload (default: 10000000)\n";
+    std::cout << "  --min-size N      - Smallest workload (default: 100)\n";
+    std::cout << "  --min-time S      - Repeat each case for at least S seconds (default: 0.2)\n";
+    std::cout << "  --algorithms A,B  - Algorithms to time (default: all)\n";
+    std::cout << "  --csv FILE        - Write results as CSV\n";
+    std::cout << "  --json FILE       - Write results and scaling exponents as JSON\n";
+    std::cout << "  --baseline FILE   - Compare against an earlier CSV; exit 1 on regressions\n";
+    std::cout << "  --tolerance T     - Allowed slowdown vs baseline (default: 0.10)\n";
+    std::cout << "  --scratch FILE    - Temporary text workload for parser runs\n";
+}
+
+int main(int argc, char* argv[]) {
+    BenchOptions options;
+    
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            print_usage(argv[0]);
+            return 0;
+        } else if (i + 1 >= argc) {
+            std::cerr << "Warning: Unknown option " << arg << "\n";
+        } else if (arg == "--max-size") {
+            options.max_size = std::atoll(argv[++i]);
+        } else if (arg == "--min-size") {
+            options.min_size = std::max(1LL, std::atoll(argv[++i]));
+        } else if (arg == "--min-time") {
+            options.min_seconds = std::atof(argv[++i]);
+        } else if (arg == "--algorithms") {
+            options.algorithms.clear();
+            std::istringstream list(argv[++i]);
+            std::string name;
+            while (std::getline(list, name, ',')) {
+                if (!name.empty()) options.algorithms.push_back(name);
+            }
+        } else if (arg == "--csv") {
+            options.csv_file = argv[++i];
+        } else if (arg == "--json") {
+            options.json_file = argv[++i];
+        } else if (arg == "--baseline") {
+            options.baseline_file = argv[++i];
+        } else if (arg == "--tolerance") {
+            options.tolerance = std::atof(argv[++i]);
+        } else if (arg == "--scratch") {
+            options.scratch_file = argv[++i];
+        } else {
+            std::cerr << "Warning: Unknown option " << arg << "\n";
+        }
+    }
+    
+    std::vector<BenchResult> results;
+    try {
+        std::cout << std::left << std::setw(30) << "Benchmark" << std::right
+                  << std::setw(10) << "Size" << std::setw(14) << "Time (ms)"
+                  << std::setw(14) << "ns/process" << std::setw(12) << "Peak RSS KB"
+                  << std::setw(8) << "Reps" << "\n";
+        std::cout << std::string(88, '-') << "\n";
+        
+        for (long long size = options.min_size; size <= options.max_size; size *= 10) {
+            run_size(size, options, results);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+    
+    std::map<std::string, double> exponents = scaling_exponents(results);
+    std::cout << "\n=== Scaling Exponents (time ~ n^k) ===\n";
+    for (const auto& entry : exponents) {
+        std::cout << std::left << std::setw(30) << entry.first << std::right
+                  << std::fixed << std::setprecision(2) << entry.second << "\n";
+    }
+    
+    if (!options.csv_file.empty()) write_csv(options.csv_file, results);
+    if (!options.json_file.empty()) write_json(options.json_file, results, exponents);
+    
+    if (!options.baseline_file.empty()) {
+        return compare_baseline(options.baseline_file, results, options.tolerance) > 0 ? 1 : 0;
+    }
+    return 0;
+}
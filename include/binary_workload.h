@@ -0,0 +1,47 @@
+#ifndef BINARY_WORKLOAD_H
+#define BINARY_WORKLOAD_H
+
+#include "process.h"
+#include "process_table.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+/**
+ * Versioned binary columnar workload format
+ *
+ * Layout (little-endian):
+ *   header (32 bytes): magic "SCHEDWKL", uint32 version, uint32 header size,
+ *                      uint64 process count, uint64 name blob size
+ *   int32 pid[count], arrival[count], burst[count], priority[count]
+ *   int32 deadline[count], period[count]   (version 2 and later)
+ *   uint32 name_offset[count + 1]   (equal neighbours = no name)
+ *   char names[name blob size]
+ *
+ * Files are written as version 2. Version 1 files (no deadline or period
+ * columns) still load, as one-shot jobs without deadlines.
+ *
+ * Jobs with CPU/I/O burst sequences are text-only: save() rejects them.
+ *
+ * Loading maps the file and copies each column into a ProcessTable, so no
+ * text is parsed. Throws std::runtime_error on malformed files.
+ */
+class BinaryWorkload {
+public:
+    static const uint32_t VERSION = 2;
+    
+    // True if the file starts with the binary workload magic
+    static bool is_binary_file(const std::string& filename);
+    
+    static void save(const std::string& filename, const ProcessTable& table);
+    static void save(const std::string& filename, const std::vector<Process>& processes);
+    
+    static ProcessTable load_table(const std::string& filename);
+    static std::vector<Process> load(const std::string& filename);
+    
+    // Convert a text workload (FileParser grammar); returns the process count
+    static size_t convert_text(const std::string& text_file, const std::string& binary_file,
+                               unsigned threads = 0);
+};
+
+#endif // BINARY_WORKLOAD_H
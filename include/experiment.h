@@ -0,0 +1,91 @@
+#ifndef EXPERIMENT_H
+#define EXPERIMENT_H
+
+#include "process.h"
+#include "performance.h"
+#include "scheduler.h"
+#include <cstddef>
+#include <vector>
+#include <string>
+
+/**
+ * Result of one scheduler run within an experiment
+ */
+struct AlgorithmRun {
+    std::string algorithm;   // Name passed to create_scheduler()
+    std::string name;        // Scheduler's display name
+    MetricsSummary metrics;
+    double seconds;          // Wall time of schedule()
+    std::string error;       // Set when the run failed
+    
+    AlgorithmRun() : seconds(0.0) {}
+};
+
+/**
+ * What a Round Robin quantum sweep minimizes
+ */
+enum class SweepObjective {
+    WAITING,           // Average waiting time
+    RESPONSE,          // Average response time
+    TURNAROUND,        // Average turnaround time
+    CONTEXT_SWITCHES   // Number of context switches
+};
+
+/**
+ * Result of one Round Robin run within a quantum sweep
+ */
+struct QuantumRun {
+    int quantum;
+    MetricsSummary metrics;
+    double seconds;          // Wall time of schedule()
+    
+    QuantumRun() : quantum(0), seconds(0.0) {}
+    
+    // Value of the given objective (lower is better)
+    double objective_value(SweepObjective objective) const;
+};
+
+/**
+ * Runs several schedulers over one parsed workload
+ * Every run gets its own Scheduler instance and thread; the input vector
+ * is shared read-only, and timelines are summarized online.
+ */
+class ExperimentRunner {
+public:
+    // Run each algorithm concurrently, one thread per algorithm.
+    // Results come back in the order the algorithms were given. Every run
+    // pays the same context-switch cost.
+    static std::vector<AlgorithmRun> compare_algorithms(const std::vector<Process>& processes,
+                                                        const std::vector<std::string>& algorithms,
+                                                        const SwitchCost& cost = SwitchCost());
+    
+    // Side-by-side table, one column per algorithm
+    static void print_comparison(const std::vector<AlgorithmRun>& runs);
+    
+    // Run Round Robin for every quantum in [min_quantum, max_quantum] (by step)
+    // on a pool of worker threads (0 = all cores). Results are ordered by quantum.
+    static std::vector<QuantumRun> sweep_round_robin(const std::vector<Process>& processes,
+                                                     int min_quantum, int max_quantum, int step = 1,
+                                                     unsigned threads = 0,
+                                                     const SwitchCost& cost = SwitchCost());
+    
+    // Index of the best run under the objective (ties go to the smaller quantum)
+    static size_t best_quantum(const std::vector<QuantumRun>& runs, SweepObjective objective);
+    
+    // One row per quantum, with the best one marked
+    static void print_sweep(const std::vector<QuantumRun>& runs, SweepObjective objective);
+    
+    // "waiting", "response", "turnaround" or "switches"
+    static SweepObjective parse_objective(const std::string& name);
+    static std::string objective_name(SweepObjective objective);
+    
+private:
+    static AlgorithmRun run_algorithm(const std::vector<Process>& processes, const std::string& algorithm,
+                                      const SwitchCost& cost);
+    
+    // Run a configured scheduler with an online metrics sink; returns schedule() wall time
+    static double run_scheduler(Scheduler& scheduler, const std::vector<Process>& processes,
+                                MetricsSummary& metrics);
+};
+
+#endif // EXPERIMENT_H
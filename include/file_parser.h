@@ -4,6 +4,36 @@
 #include "process.h"
 #include <vector>
 #include <string>
+#include <cstddef>
+
+/**
+ * A rejected input line, reported as "Error parsing line N: ..."
+ */
+struct ParseDiagnostic {
+    int line_number;
+    std::string message;
+    std::string line;
+    
+    ParseDiagnostic(int number, const std::string& msg, const std::string& content)
+        : line_number(number), message(msg), line(content) {}
+};
+
+/**
+ * Counters and rejected lines reported by the fast parsing mode
+ */
+struct ParseStats {
+    size_t lines;       // Lines read, including comments and blanks
+    size_t processes;   // Processes parsed successfully
+    size_t errors;      // Lines rejected
+    size_t bytes;       // Input size
+    double seconds;     // Wall time spent parsing
+    unsigned threads;   // Worker threads used
+    std::vector<ParseDiagnostic> diagnostics;  // Rejected lines, in file order
+    
+    ParseStats() : lines(0), processes(0), errors(0), bytes(0), seconds(0.0), threads(1) {}
+    
+    double lines_per_second() const { return seconds > 0.0 ? lines / seconds : 0.0; }
+};
 
 /**
  * Utility class for reading process data from files
@@ -17,6 +47,26 @@ public:
     // Parse from string (useful for testing)
     static std::vector<Process> parse_string(const std::string& data);
     
+    // Fast mode: memory-maps the file and tokenizes in place without
+    // per-line allocations. Same grammar and error messages as parse_file().
+    static std::vector<Process> parse_file_fast(const std::string& filename, ParseStats* stats = nullptr);
+    static std::vector<Process> parse_buffer(const char* data, size_t size, ParseStats* stats = nullptr);
+    
+    // Parallel fast mode: splits the mapped file into newline-aligned chunks
+    // parsed on worker threads (0 = one per hardware thread). Results and
+    // diagnostics keep file order and original line numbers.
+    static std::vector<Process> parse_file_parallel(const std::string& filename, unsigned threads = 0,
+                                                    ParseStats* stats = nullptr);
+    static std::vector<Process> parse_buffer_parallel(const char* data, size_t size, unsigned threads = 0,
+                                                      ParseStats* stats = nullptr);
+    
+    // Release each periodic task (period > 0) again every period before
+    // `horizon`: job k arrives at arrival + k * period, with its deadline
+    // shifted alike. The first release keeps the task's PID; later ones get
+    // fresh PIDs above the largest in use, in release order. Every job in
+    // the result is one-shot (period 0).
+    static std::vector<Process> expand_periodic(const std::vector<Process>& tasks, int horizon);
+    
     // Generate sample data files
     static void generate_sample_files();
     
@@ -25,6 +75,12 @@ private:
     static std::vector<std::string> split_line(const std::string& line, char delimiter = ' ');
     static bool is_comment_or_empty(const std::string& line);
     static Process parse_process_line(const std::string& line, int line_number);
+    
+    // Fast-mode helpers. parse_range() handles whole lines in [begin, end),
+    // numbering them from first_line, and returns the number of lines read.
+    static size_t parse_range(const char* begin, const char* end, int first_line,
+                              std::vector<Process>& out, std::vector<ParseDiagnostic>& diagnostics);
+    static void report_diagnostics(const std::vector<ParseDiagnostic>& diagnostics);
 };
 
 #endif // FILE_PARSER_H
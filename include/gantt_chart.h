@@ -3,12 +3,15 @@
 
 #include <vector>
 #include <string>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 
 /**
  * Represents a single time slot in the Gantt chart
  */
 struct GanttEntry {
-    int pid;           // Process ID (-1 for idle time)
+    int pid;           // Process ID (-1 for idle time, -2 for context-switch overhead)
     int start_time;    // Start time of this slot
     int end_time;      // End time of this slot
     
@@ -16,38 +19,180 @@ struct GanttEntry {
     
     int duration() const { return end_time - start_time; }
     bool is_idle() const { return pid == -1; }
+    bool is_overhead() const { return pid == -2; }
+};
+
+/**
+ * Timeline totals that metrics need from a Gantt chart
+ * Produced by GanttChart::summarize() or accumulated online by a GanttSink
+ */
+struct GanttSummary {
+    int total_time;        // End of the last slice
+    int idle_time;         // Sum of idle slices
+    int overhead_time;     // Sum of context-switch overhead slices
+    int context_switches;  // Adjacent non-idle slices with different PIDs
+                           // (overhead slices in between are skipped)
+    size_t slices;         // Number of (coalesced) slices
+    int cpus;              // Timelines combined into this summary
+    
+    // I/O lane (GanttChart only; zero when nothing blocked on I/O)
+    int io_time;           // Sum of all I/O waits
+    int io_busy_time;      // Time during which at least one job was in I/O
+    int io_overlap_time;   // Part of io_busy_time during which the CPU ran a job
+    
+    GanttSummary()
+        : total_time(0), idle_time(0), overhead_time(0), context_switches(0), slices(0), cpus(1),
+          io_time(0), io_busy_time(0), io_overlap_time(0) {}
+    
+    // Share of the capacity (total_time on each CPU) spent running
+    // processes; idle time and switch overhead are both lost
+    double cpu_utilization() const {
+        if (total_time == 0) return 0.0;
+        double capacity = static_cast<double>(total_time) * cpus;
+        return (capacity - idle_time - overhead_time) / capacity * 100.0;
+    }
+    
+    // Totals over several CPUs: makespan is the longest timeline, idle time
+    // and switches add up. Each CPU counts as idle after its last slice.
+    static GanttSummary combine(const std::vector<GanttSummary>& per_cpu);
+};
+
+/**
+ * Destination for the time slices produced by a Scheduler
+ * GanttChart is the in-memory sink; see gantt_sink.h for streaming sinks.
+ */
+class GanttSink {
+public:
+    virtual ~GanttSink() = default;
+    
+    // Record a slice (pid -1 for idle time, -2 for switch overhead)
+    virtual void record(int pid, int start_time, int end_time) = 0;
+    
+    // Record an I/O wait of a blocked process. It overlaps the CPU slices,
+    // so it goes to a separate lane; sinks that only follow the CPU
+    // timeline ignore it.
+    virtual void record_io(int /*pid*/, int /*start_time*/, int /*end_time*/) {}
+    
+    // Drop everything recorded so far
+    virtual void reset() = 0;
 };
 
 /**
  * Gantt Chart for visualizing CPU scheduling
  * Shows which process runs at what time
+ *
+ * Entries are kept either expanded (a vector of GanttEntry) or, after
+ * set_compact(true), in a compact form: 32-bit PIDs in one array and
+ * varint-encoded timing in another (start as a delta from the previous
+ * end, then duration). Iterate with begin()/end() to read either form.
+ *
+ * I/O waits are kept in a separate lane in the order they were recorded.
  */
-class GanttChart {
+class GanttChart : public GanttSink {
 private:
     std::vector<GanttEntry> entries;
     
+    // Compact form. The newest entry stays un-encoded in the tail so that
+    // add_coalesced() can still extend it.
+    bool compact_mode;
+    std::vector<int32_t> compact_pids;
+    std::vector<uint8_t> compact_timing;
+    int encoded_end;  // end_time of the last encoded entry
+    bool has_tail;
+    int tail_pid, tail_start, tail_end;
+    
+    // I/O lane: waits of blocked processes, overlapping the CPU entries
+    std::vector<GanttEntry> io_entries;
+    
+    // Expanded copy handed out by get_entries() in compact mode
+    mutable std::vector<GanttEntry> decoded;
+    mutable bool decoded_valid;
+    
 public:
+    /**
+     * Forward iterator over entries, valid for both storage forms.
+     * Entries are produced by value.
+     */
+    class const_iterator {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef GanttEntry value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const GanttEntry* pointer;
+        typedef const GanttEntry& reference;
+        
+        const_iterator(const GanttChart* chart, size_t index);
+        
+        const GanttEntry& operator*() const { return current; }
+        const GanttEntry* operator->() const { return &current; }
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator& other) const { return index == other.index; }
+        bool operator!=(const const_iterator& other) const { return index != other.index; }
+        
+    private:
+        const GanttChart* chart;
+        size_t index;
+        size_t byte_pos;  // read position in compact_timing
+        int prev_end;
+        GanttEntry current;
+        
+        void load();
+    };
+    
+    GanttChart();
+    
     // Add a time slot to the chart
     void add_entry(int pid, int start_time, int end_time);
     
+    // Add a time slot, merging it into the previous slot when the PID is the
+    // same and the two slots touch
+    void add_coalesced(int pid, int start_time, int end_time);
+    
     // Add idle time
     void add_idle(int start_time, int end_time);
     
+    // Add an I/O wait to the I/O lane
+    void add_io(int pid, int start_time, int end_time);
+    
     // Clear all entries
     void clear();
     
+    // GanttSink interface (records coalesced slices)
+    void record(int pid, int start_time, int end_time) override;
+    void record_io(int pid, int start_time, int end_time) override;
+    void reset() override;
+    
+    // Switch between expanded and compact storage (keeps the entries)
+    void set_compact(bool compact);
+    bool is_compact() const;
+    
     // Display functions
     void print() const;
     void print_detailed() const;
     
+    // Iteration (works in both storage forms)
+    const_iterator begin() const;
+    const_iterator end() const;
+    size_t size() const;
+    bool empty() const;
+    
     // Getters
-    const std::vector<GanttEntry>& get_entries() const;
+    const std::vector<GanttEntry>& get_entries() const;  // Decodes on demand when compact
+    const std::vector<GanttEntry>& get_io_entries() const;
     int get_total_time() const;
     int get_total_idle_time() const;
     double get_cpu_utilization() const;
+    GanttSummary summarize() const;  // All timeline totals in one pass
+    size_t get_memory_usage() const;  // Approximate bytes used by the entries
     
     // Validation
     bool is_valid() const;  // Check for gaps or overlaps
+
+private:
+    void append_encoded(int pid, int start_time, int end_time);
+    void flush_tail();
+    void summarize_io(GanttSummary& summary) const;  // Fills the io_* totals
 };
 
 #endif // GANTT_CHART_H
@@ -0,0 +1,56 @@
+#ifndef GANTT_SINK_H
+#define GANTT_SINK_H
+
+#include "gantt_chart.h"
+#include <fstream>
+#include <string>
+
+/**
+ * Online timeline metrics
+ * Accumulates idle time, context switches and makespan as slices arrive,
+ * using O(1) memory no matter how long the simulation runs
+ */
+class GanttMetricsSink : public GanttSink {
+private:
+    GanttSummary totals;
+    bool has_last;
+    int last_pid;
+    int last_end;
+    int last_switch_pid;  // Last PID other than overhead, for switch counting
+    
+public:
+    GanttMetricsSink();
+    
+    void record(int pid, int start_time, int end_time) override;
+    void reset() override;
+    
+    const GanttSummary& summary() const;
+};
+
+/**
+ * Streams slices to a text file as "start end pid" lines (pid -1 = idle)
+ * Touching slices of the same PID are merged before they are written.
+ * Also keeps the online totals, so metrics are available without a chart.
+ */
+class FileGanttSink : public GanttMetricsSink {
+private:
+    std::string filename;
+    std::ofstream out;
+    bool has_pending;
+    int pending_pid, pending_start, pending_end;
+    
+public:
+    explicit FileGanttSink(const std::string& filename);
+    ~FileGanttSink();
+    
+    void record(int pid, int start_time, int end_time) override;
+    void reset() override;  // Truncates the file
+    
+    // Write out the buffered slice and flush the stream
+    void flush();
+
+private:
+    void open_file();
+};
+
+#endif // GANTT_SINK_H
@@ -0,0 +1,114 @@
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+/**
+ * Binary min-heap of integer ids with a position index
+ * Ids are dense (0 .. capacity-1, e.g. process slots) and their keys live
+ * outside the heap; `Less(a, b)` says whether id `a` belongs above id `b`.
+ * The position index lets a changed key be fixed in place with update()
+ * (or an id be removed with erase()) in O(log n) instead of a rebuild.
+ */
+template <typename Less>
+class IndexedHeap {
+public:
+    static const size_t npos = static_cast<size_t>(-1);
+    
+    explicit IndexedHeap(Less less = Less()) : less(less) {}
+    
+    // Empty the heap and accept ids in [0, capacity)
+    void reset(size_t capacity) {
+        heap.clear();
+        heap.reserve(capacity);
+        position.assign(capacity, npos);
+    }
+    
+    bool contains(size_t id) const { return id < position.size() && position[id] != npos; }
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+    size_t top() const { return heap.front(); }
+    
+    void push(size_t id) {
+        if (id >= position.size()) {
+            throw std::out_of_range("IndexedHeap id out of range");
+        }
+        if (contains(id)) return;
+        heap.push_back(id);
+        position[id] = heap.size() - 1;
+        sift_up(heap.size() - 1);
+    }
+    
+    size_t pop() {
+        size_t id = heap.front();
+        erase(id);
+        return id;
+    }
+    
+    // Restore heap order after the key of `id` changed in either direction
+    void update(size_t id) {
+        if (!contains(id)) return;
+        size_t i = position[id];
+        sift_up(i);
+        sift_down(position[id]);
+    }
+    
+    void erase(size_t id) {
+        if (!contains(id)) return;
+        size_t i = position[id];
+        size_t last = heap.size() - 1;
+        position[id] = npos;
+        if (i != last) {
+            // Move the last id into the hole, then let it settle either way
+            size_t moved = heap[last];
+            heap.pop_back();
+            place(i, moved);
+            sift_up(i);
+            sift_down(position[moved]);
+        } else {
+            heap.pop_back();
+        }
+    }
+
+private:
+    std::vector<size_t> heap;      // Ids in heap order
+    std::vector<size_t> position;  // id -> index in `heap`, npos when absent
+    Less less;
+    
+    void place(size_t i, size_t id) {
+        heap[i] = id;
+        position[id] = i;
+    }
+    
+    void sift_up(size_t i) {
+        size_t id = heap[i];
+        while (i > 0) {
+            size_t parent = (i - 1) / 2;
+            if (!less(id, heap[parent])) break;
+            place(i, heap[parent]);
+            i = parent;
+        }
+        place(i, id);
+    }
+    
+    void sift_down(size_t i) {
+        size_t id = heap[i];
+        const size_t n = heap.size();
+        while (true) {
+            size_t child = 2 * i + 1;
+            if (child >= n) break;
+            if (child + 1 < n && less(heap[child + 1], heap[child])) child++;
+            if (!less(heap[child], id)) break;
+            place(i, heap[child]);
+            i = child;
+        }
+        place(i, id);
+    }
+};
+
+template <typename Less>
+const size_t IndexedHeap<Less>::npos;
+
+#endif // INDEXED_HEAP_H
@@ -0,0 +1,32 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/**
+ * Read-only view of a whole file
+ * Memory-maps the file on POSIX systems; elsewhere the file is read into
+ * a buffer. Throws std::runtime_error if the file cannot be opened.
+ */
+class MappedFile {
+private:
+    const char* bytes;
+    size_t length;
+    void* mapping;               // mmap base, or nullptr when buffered
+    std::vector<char> buffer;    // Fallback storage
+    
+public:
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+    
+    const char* data() const { return bytes; }
+    size_t size() const { return length; }
+    
+private:
+    MappedFile(const MappedFile&);             // Not copyable
+    MappedFile& operator=(const MappedFile&);
+};
+
+#endif // MAPPED_FILE_H
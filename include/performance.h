@@ -4,20 +4,99 @@
 #include "process.h"
 #include "gantt_chart.h"
 #include <vector>
+#include <memory>
+
+/**
+ * All scheduling metrics, computed together in one pass
+ */
+struct MetricsSummary {
+    double average_turnaround_time;
+    double average_waiting_time;
+    double average_response_time;
+    double cpu_utilization;
+    double throughput;
+    double fairness_index;
+    int context_switches;
+    int total_time;
+    int total_processes;
+    int completed_processes;
+    bool valid;  // Every process has consistent start/completion times
+    
+    MetricsSummary()
+        : average_turnaround_time(0.0), average_waiting_time(0.0), average_response_time(0.0),
+          cpu_utilization(0.0), throughput(0.0), fairness_index(1.0), context_switches(0),
+          total_time(0), total_processes(0), completed_processes(0), valid(true) {}
+};
+
+/**
+ * CPU time a process received against the share its tickets entitle it to
+ * Entitled time integrates tickets / (tickets of all jobs present) over the
+ * process's lifetime, so 1.0 means it got exactly its proportional share.
+ */
+struct ShareRecord {
+    int pid;
+    int tickets;
+    double entitled;  // Entitled CPU time
+    int received;     // CPU time actually received
+    
+    double ratio() const { return entitled > 0.0 ? received / entitled : 0.0; }
+};
+
+/**
+ * Deadline outcomes over the completed processes that have a deadline
+ * Lateness is completion - deadline (negative = early); tardiness is
+ * lateness clamped at 0. Percentiles are nearest-rank.
+ */
+struct DeadlineStats {
+    int jobs;             // Completed jobs with a deadline
+    int missed;           // Completed after their deadline
+    double miss_ratio;
+    int max_lateness;
+    double mean_tardiness;
+    int tardiness_p50;
+    int tardiness_p95;
+    int tardiness_p99;
+    int max_tardiness;
+    
+    DeadlineStats()
+        : jobs(0), missed(0), miss_ratio(0.0), max_lateness(0), mean_tardiness(0.0),
+          tardiness_p50(0), tardiness_p95(0), tardiness_p99(0), max_tardiness(0) {}
+};
 
 /**
  * Performance metrics for CPU scheduling algorithms
  * Students need to implement the calculation functions
+ *
+ * The regular constructors keep a private copy of the processes. The view()
+ * factories only reference the caller's vector (which must outlive the
+ * metrics object), avoiding a second copy of large workloads.
  */
 class PerformanceMetrics {
 private:
-    std::vector<Process> processes;
-    GanttChart gantt;
+    std::shared_ptr<const std::vector<Process> > processes;  // Owned copy or view
+    GanttSummary timeline;  // Totals from the chart; the chart itself is not kept
+    std::vector<GanttSummary> cpu_timelines;  // Multi-CPU runs only, one per CPU
+    std::vector<GanttEntry> share_gaps;  // I/O waits and idle/overhead slices (see calculate_shares)
+    MetricsSummary totals;
     
 public:
-    // Constructor
+    // Constructors
     PerformanceMetrics(const std::vector<Process>& procs, const GanttChart& chart);
     
+    // From totals gathered online (e.g. GanttMetricsSink), without a chart
+    PerformanceMetrics(const std::vector<Process>& procs, const GanttSummary& summary);
+    
+    // Multi-CPU run with one chart per CPU (see SMPScheduler)
+    PerformanceMetrics(const std::vector<Process>& procs, const std::vector<GanttChart>& cpu_charts);
+    
+    // Non-owning views over scheduler results (no copy of the processes)
+    static PerformanceMetrics view(const std::vector<Process>& procs, const GanttChart& chart);
+    static PerformanceMetrics view(const std::vector<Process>& procs, const GanttSummary& summary);
+    static PerformanceMetrics view(const std::vector<Process>& procs, const std::vector<GanttChart>& cpu_charts);
+    
+    // Everything below, as computed by the fused pass
+    const MetricsSummary& summary() const;
+    
     // Basic metrics (students implement these)
     double calculate_average_turnaround_time() const;
     double calculate_average_waiting_time() const;
@@ -29,16 +108,51 @@ public:
     double calculate_fairness_index() const;  // How fair is the scheduling?
     int calculate_context_switches() const;   // Number of process switches
     
+    // Per-CPU view of multi-CPU runs (a single-CPU run reports one CPU)
+    int get_cpu_count() const;
+    double calculate_cpu_utilization(int cpu) const;  // Busy share of the makespan
+    int get_cpu_busy_time(int cpu) const;
+    double calculate_load_imbalance() const;  // Max / mean busy time (1.0 = even)
+    
+    // Proportional share (see share_tickets); completed processes only.
+    // A job is entitled to its share while it is runnable and the CPU runs a
+    // job. Built from a summary instead of a chart, the I/O waits and idle
+    // time are unknown and a job counts from arrival to completion.
+    std::vector<ShareRecord> calculate_shares() const;
+    double calculate_share_error() const;  // Sum |received - entitled| / sum received
+    
+    // Real-time view: deadline misses, lateness and tardiness percentiles
+    DeadlineStats calculate_deadline_stats() const;
+    
+    // CPU/I/O overlap, from the chart's I/O lane (0 without one)
+    int get_total_io_time() const;      // Sum of all I/O waits
+    double calculate_io_overlap() const;  // % of I/O-active time the CPU was also busy
+    
+    // Time spent on context-switch overhead (see SwitchCost; 0 without one)
+    int get_overhead_time() const;
+    
     // Display functions
     void print_summary() const;
     void print_detailed() const;
     void print_process_metrics() const;
+    void print_share_report(bool per_process = true) const;  // Received vs entitled share
+    void print_deadline_report() const;
+    void print_io_report() const;  // CPU utilization alongside I/O activity
     
     // Helper functions (provided to students)
     int get_total_time() const;
     int get_total_processes() const;
     
 private:
+    PerformanceMetrics(std::shared_ptr<const std::vector<Process> > procs, const GanttSummary& summary);
+    PerformanceMetrics(std::shared_ptr<const std::vector<Process> > procs,
+                       const std::vector<GanttSummary>& per_cpu);
+    
+    // Single pass over the processes that fills `totals`
+    void compute();
+    
+    void collect_share_gaps(const GanttChart& chart);
+    
     // Helper function for students to understand
     bool is_valid_metrics() const;  // Check if all processes have valid timing
 };
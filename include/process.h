@@ -2,21 +2,60 @@
 #define PROCESS_H
 
 #include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * Side table of interned process names
+ * Each distinct name is stored once and referenced from Process by id,
+ * so processes stay small and trivially copyable. Id 0 means "no name".
+ * Thread-safe, so workers may parse and intern concurrently.
+ */
+class NameTable {
+public:
+    static uint32_t intern(const std::string& name);
+    static std::string lookup(uint32_t id);
+    static size_t size();  // Number of distinct names interned
+};
+
+/**
+ * Side table of interned CPU/I/O burst sequences
+ * A sequence alternates CPU and I/O bursts, starting and ending with a CPU
+ * burst (so its length is odd). Process keeps only the id; id 0 means a
+ * single CPU burst of burst_time. Thread-safe, like NameTable.
+ */
+class BurstTable {
+public:
+    static uint32_t intern(const std::vector<int>& bursts);
+    static std::vector<int> lookup(uint32_t id);
+    static int burst(uint32_t id, int index);  // One entry, without copying the sequence
+    static size_t size();  // Number of distinct sequences interned
+};
 
 /**
  * Represents a process in the CPU scheduling simulation
+ *
+ * Fields are ordered so the state the schedulers touch on every decision
+ * sits together at the front. The display name lives in NameTable.
  */
 class Process {
 public:
-    // Process identification
+    // Hot scheduling state
     int pid;                    // Process ID
-    std::string name;          // Process name (optional)
-    
-    // Timing information
     int arrival_time;          // When process arrives in the system
     int burst_time;            // Total CPU time needed
     int remaining_time;        // Remaining CPU time (for preemptive algorithms)
     int priority;              // Process priority (lower number = higher priority)
+    int deadline;              // Absolute deadline (-1 = none)
+    int period;                // Release period of a periodic task (0 = one-shot)
+    int burst_left;            // CPU time left in the current CPU burst
+    bool blocked;              // Waiting for an I/O burst to finish
+    
+    // CPU/I/O bursts (burst_time above is the CPU total over all of them)
+    uint32_t bursts_id;        // Interned burst sequence (0 = one CPU burst)
+    int io_time;               // Total I/O time over all bursts
+    int burst_index;           // Position of the current CPU burst in the sequence
+    int ready_time;            // Arrival, or the end of the last I/O wait
     
     // Scheduling results (filled during simulation)
     int start_time;            // When process first gets CPU
@@ -26,20 +65,29 @@ public:
     int response_time;         // start_time - arrival_time
     
     // State tracking
-    bool has_started;          // Has the process started execution?
     int last_run_time;         // Last time this process ran (for time slice tracking)
+    bool has_started;          // Has the process started execution?
+    
+    // Process identification
+    uint32_t name_id;          // Interned name (0 = default "P<pid>")
     
     // Constructor
     Process(int pid, int arrival, int burst, int priority = 0, const std::string& name = "");
     
-    // Copy constructor
-    Process(const Process& other);
+    // Copy and move are implicit: every field is a plain value
+    
+    // Name access
+    std::string name() const;
+    void set_name(const std::string& name);
     
-    // Assignment operator
-    Process& operator=(const Process& other);
+    // Replace the single CPU burst with a CPU/I/O sequence (see BurstTable)
+    void set_bursts(const std::vector<int>& bursts);
     
     // Utility functions
     bool is_complete() const;
+    bool is_runnable() const;     // Not complete and not blocked on I/O
+    bool has_io() const;
+    bool has_deadline() const;
     void reset_for_simulation();  // Reset timing fields for new simulation
     void calculate_metrics();     // Calculate turnaround, waiting, response times
     
@@ -51,4 +99,12 @@ public:
     bool operator<(const Process& other) const;  // Compare by arrival time
 };
 
+/**
+ * Proportional-share tickets for a priority (lower number = more tickets):
+ * 100 / (1 + priority), with negative priorities treated as 0 and at least
+ * one ticket for priorities of 99 and above. Used by the lottery and stride
+ * schedulers and by the entitled-share metric.
+ */
+int share_tickets(int priority);
+
 #endif // PROCESS_H
@@ -0,0 +1,44 @@
+#ifndef PROCESS_TABLE_H
+#define PROCESS_TABLE_H
+
+#include "process.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Structure-of-arrays process table
+ * Each field lives in its own contiguous array, which is how the workload
+ * generator and the binary format produce and store workloads in bulk.
+ * Slot i in every column describes the same process.
+ */
+class ProcessTable {
+public:
+    std::vector<int> pid;
+    std::vector<int> arrival_time;
+    std::vector<int> burst_time;
+    std::vector<int> remaining_time;
+    std::vector<int> priority;
+    std::vector<int> deadline;  // Absolute, -1 = none
+    std::vector<int> period;    // 0 = one-shot
+    std::vector<uint32_t> name_id;
+    std::vector<uint32_t> bursts_id;  // CPU/I/O sequence, 0 = one CPU burst
+    
+    ProcessTable();
+    explicit ProcessTable(const std::vector<Process>& procs);
+    
+    // Conversion from / to the array-of-structs form
+    void assign(const std::vector<Process>& procs);
+    std::vector<Process> to_processes() const;
+    Process make_process(size_t slot) const;
+    
+    // Building
+    void add(int pid, int arrival, int burst, int priority = 0, uint32_t name_id = 0,
+             int deadline = -1, int period = 0);
+    void reserve(size_t count);
+    void clear();
+    size_t size() const;
+    bool empty() const;
+};
+
+#endif // PROCESS_TABLE_H
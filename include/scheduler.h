@@ -3,21 +3,190 @@
 
 #include "process.h"
 #include "gantt_chart.h"
+#include "process_table.h"
 #include <vector>
 #include <string>
+#include <queue>
+#include <functional>
+#include <utility>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Ordering policies for ReadyQueue
+ * Ties are broken by PID so every policy is deterministic
+ */
+enum class ReadyOrder {
+    FIFO,                // Enqueue order (FCFS, Round Robin)
+    SHORTEST_BURST,      // Smallest burst_time first (SJF)
+    SHORTEST_REMAINING,  // Smallest remaining_time first (STCF)
+    PRIORITY,            // Lowest priority number first, then arrival time
+    EARLIEST_DEADLINE    // Earliest absolute deadline first (EDF), then arrival
+                         // time; jobs without a deadline go last
+};
+
+/**
+ * Pending I/O completions, earliest first
+ * Each event is (wakeup time, process slot); equal times wake in slot
+ * order, so runs are deterministic.
+ */
+class IoWakeupQueue {
+private:
+    typedef std::pair<int, size_t> Event;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event> > events;
+
+public:
+    void push(int time, size_t slot);
+    bool empty() const;
+    size_t size() const;
+    int next_time() const;  // -1 when empty
+    size_t pop();           // Slot of the earliest wakeup
+    void clear();
+};
+
+/**
+ * Cursor over a process list sorted by arrival time
+ * Hands out each process once the simulation clock reaches its arrival.
+ * When attached to an IoWakeupQueue it also hands out processes whose I/O
+ * has finished (clearing their blocked state), so a wakeup looks like an
+ * arrival to the scheduler. At equal times, arrivals come first.
+ */
+class ArrivalCursor {
+private:
+    std::vector<Process>* source;
+    size_t next;
+    IoWakeupQueue* wakeups;
+
+public:
+    ArrivalCursor();
+    
+    // The list must stay sorted by arrival time and must not be resized.
+    // Wakeup slots index into the same list.
+    void attach(std::vector<Process>& arrival_sorted, IoWakeupQueue* wakeups = nullptr);
+    
+    bool has_pending() const;
+    int next_arrival_time() const;   // Arrival or wakeup; -1 when nothing is left
+    Process* pop_arrived(int time);  // Next process ready by `time`, or nullptr
+};
+
+/**
+ * Ready queue shared by the scheduling algorithms
+ * Pulls arrivals from an ArrivalCursor and orders ready processes by a
+ * pluggable policy. FIFO order uses a ring buffer, the other policies a
+ * binary heap; neither allocates once it has grown to the working set.
+ */
+class ReadyQueue {
+private:
+    ReadyOrder order;
+    ArrivalCursor arrivals;
+    
+    // FIFO ring buffer
+    std::vector<Process*> ring;
+    size_t ring_head;
+    size_t ring_size;
+    
+    // Binary heap for the ordered policies
+    std::vector<Process*> heap;
+
+public:
+    explicit ReadyQueue(ReadyOrder order = ReadyOrder::FIFO);
+    
+    // Take arrivals from an arrival-sorted process list (and I/O wakeups,
+    // see ArrivalCursor)
+    void attach(std::vector<Process>& arrival_sorted, IoWakeupQueue* wakeups = nullptr);
+    
+    // Move every incomplete process that has arrived (or woken) by `time` into the queue
+    void admit_arrivals(int time);
+    bool has_pending_arrivals() const;
+    int next_arrival_time() const;  // O(1); -1 when nothing is left to arrive
+    
+    // Queue operations
+    void push(Process* process);
+    Process* pop();
+    
+    // Remove from the far end, away from the next job to run: the newest
+    // entry in FIFO order, the last heap leaf otherwise. Used by work
+    // stealing so the owner keeps its best candidates. nullptr when empty.
+    Process* steal();
+    Process* top() const;
+    bool empty() const;
+    size_t size() const;
+    void clear();
+    
+    // True if `a` should run before `b` under this queue's policy
+    bool runs_before(const Process* a, const Process* b) const;
+    ReadyOrder get_order() const;
+
+private:
+    bool heap_less(const Process* a, const Process* b) const;
+};
+
+/**
+ * Cost of a context switch, charged to the simulation clock
+ * Dispatching a process other than the last one to run costs `dispatch`
+ * time units plus a cache warmup penalty that grows with how long the
+ * process was descheduled: cache_penalty * min(away, cache_decay) /
+ * cache_decay, and the full penalty on its first dispatch. All zero (the
+ * default) makes switches free.
+ */
+struct SwitchCost {
+    int dispatch;       // Fixed cost of every switch
+    int cache_penalty;  // Warmup cost for a fully cold cache
+    int cache_decay;    // Time off the CPU after which the cache is fully cold
+    
+    SwitchCost() : dispatch(0), cache_penalty(0), cache_decay(1) {}
+    
+    bool enabled() const { return dispatch > 0 || cache_penalty > 0; }
+    
+    // Warmup cost after `away` time units off the CPU (-1 = never ran)
+    int warmup(int away) const {
+        if (away < 0 || away >= cache_decay) return cache_penalty;
+        return static_cast<int>(static_cast<long long>(cache_penalty) * away / cache_decay);
+    }
+};
 
 /**
  * Abstract base class for all scheduling algorithms
  * Students will inherit from this class to implement specific algorithms
+ *
+ * Processes with CPU/I/O burst sequences block when a CPU burst ends:
+ * run_process() never runs past the current burst (burst_left), records
+ * the I/O wait in the Gantt chart's I/O lane and queues a wakeup in
+ * `io_wakeups`. Attach arrival cursors and ready queues to `io_wakeups` so
+ * woken processes come back like arrivals, and requeue a process after a
+ * slice only if it is still runnable.
+ *
+ * With a SwitchCost set, run_process() charges the switch before the slice
+ * whenever the process differs from the last one dispatched; the overhead
+ * advances the clock and shows in the Gantt chart as pid -2. Idle time does
+ * not count as a switch.
  */
 class Scheduler {
 protected:
     std::vector<Process> processes;
     std::vector<Process> original_processes;  // Keep original for reset
     GanttChart gantt;
+    GanttSink* gantt_sink;  // Where slices go; defaults to `gantt`
+    IoWakeupQueue io_wakeups;  // Blocked processes by I/O completion time
     int current_time;
     std::string algorithm_name;
 
+private:
+    // PID -> index into `processes`. A dense array is used when PIDs are
+    // compact (the common case); sparse PID sets fall back to a hash map.
+    std::vector<int> pid_slots;
+    std::unordered_map<int, int> sparse_pid_slots;
+    bool dense_pid_index;
+    
+    // Number of processes not yet complete, maintained by run_process()
+    int remaining_jobs;
+    
+    // Context-switch cost model (see SwitchCost)
+    SwitchCost switch_cost;
+    int last_pid;                    // Last process dispatched (-1 = none yet)
+    std::vector<int> off_cpu_since;  // Per slot end of the last slice (-1 = never ran)
+
 public:
     // Constructor
     Scheduler(const std::string& name);
@@ -30,14 +199,27 @@ public:
     
     // Common functionality provided to students
     void load_processes(const std::vector<Process>& procs);
+    void load_processes(std::vector<Process>&& procs);  // Takes over the caller's vector
+    void load_processes(const ProcessTable& procs);
     void reset_simulation();
     void print_results() const;
     void print_gantt_chart() const;
+    void set_compact_gantt(bool compact);  // Store the Gantt chart in compact form
+    
+    // Send slices to another sink instead of the in-memory chart (not owned;
+    // nullptr restores the chart). See gantt_sink.h for streaming sinks.
+    void set_gantt_sink(GanttSink* sink);
+    
+    // Charge context switches to the clock (throws std::runtime_error on
+    // negative costs or a non-positive cache_decay)
+    void set_switch_cost(const SwitchCost& cost);
+    const SwitchCost& get_switch_cost() const;
     
     // Getters
     const std::vector<Process>& get_processes() const;
     const GanttChart& get_gantt_chart() const;
     std::string get_algorithm_name() const;
+    int remaining_count() const;  // Jobs still to complete (O(1))
     
 protected:
     // Helper functions for students to use
@@ -48,11 +230,27 @@ protected:
     Process* find_process_by_pid(int pid);
     void advance_time(int new_time);
     
+    // Bookkeeping half of run_process(): charge up to `duration` units of CPU
+    // starting at `start` to `process` (start, remaining and completion
+    // times) without touching the clock or the CPU timeline. Returns the time
+    // actually used, which stops at the end of the current CPU burst; if I/O
+    // follows, the process blocks (see above). The process must be in
+    // `processes` and runnable.
+    int account_run(Process* process, int start, int duration);
+    
     // Utility functions
     void sort_by_arrival_time();
     void sort_by_burst_time();
     void sort_by_priority();
     void sort_by_remaining_time();
+
+private:
+    // Rebuild the per-slot state after `processes` is replaced or reordered
+    void reindex_processes();
+    void rebuild_pid_index();
+    void recount_remaining_jobs();
+    void start_io(Process* process, int time);  // Block `process` for its next I/O burst
+    void charge_switch(Process* process);        // Context-switch overhead before a slice
 };
 
 /**
@@ -61,4 +259,24 @@ protected:
  */
 Scheduler* create_scheduler(const std::string& algorithm);
 
+// Every algorithm create_scheduler() accepts, one name each (no aliases)
+const std::vector<std::string>& scheduler_names();
+
+// Round Robin with an explicit time quantum (must be positive)
+Scheduler* create_round_robin_scheduler(int time_quantum);
+
+// Priority scheduling with aging every `aging_interval` time units (0 = no aging)
+Scheduler* create_priority_scheduler(bool preemptive, int aging_interval);
+
+// MLFQ with one quantum per level (level 0 first) and a priority boost every
+// `boost_period` time units (0 = never, negative = the default of 100)
+Scheduler* create_mlfq_scheduler(const std::vector<int>& quanta, int boost_period);
+
+// CFS with the given scheduling period target and minimum slice
+Scheduler* create_cfs_scheduler(int target_latency, int min_granularity);
+
+// Proportional share with share_tickets(priority) tickets per job
+Scheduler* create_lottery_scheduler(int time_quantum, uint64_t seed);
+Scheduler* create_stride_scheduler(int time_quantum);
+
 #endif // SCHEDULER_H
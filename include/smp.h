@@ -0,0 +1,107 @@
+#ifndef SMP_H
+#define SMP_H
+
+#include "scheduler.h"
+#include "gantt_chart.h"
+#include <vector>
+#include <string>
+#include <random>
+#include <cstdint>
+
+/**
+ * Where ready processes wait in a multi-CPU simulation
+ */
+enum class DispatchMode {
+    GLOBAL,   // One ready queue shared by every CPU
+    PER_CPU   // One queue per CPU; arrivals go to the least loaded CPU and
+              // preempted jobs return to the CPU they ran on
+};
+
+/**
+ * How an idle CPU with an empty run queue picks a victim (PER_CPU only)
+ * The thief takes one job from the far end of the victim's queue.
+ */
+enum class StealPolicy {
+    NONE,     // Never steal; idle CPUs wait for their own arrivals
+    BUSIEST,  // Steal from the longest queue (lowest CPU index on ties)
+    RANDOM    // Steal from a random non-empty queue (seeded, reproducible)
+};
+
+/**
+ * Multi-CPU (SMP) simulation of the FCFS, SJF, STCF, EDF and RR policies
+ *
+ * Each CPU has its own GanttChart. The simulation is event-driven: at every
+ * arrival or slice end it admits arrivals, requeues expired slices,
+ * dispatches idle CPUs and (for STCF and EDF) preempts the running job that a
+ * waiting one beats, then jumps to the next event. Per-process bookkeeping
+ * goes through Scheduler::account_run(), so metrics match the single-CPU
+ * schedulers; with one CPU the results are identical to them.
+ *
+ * With PER_CPU dispatch, idle CPUs whose own queue is empty can steal work
+ * from other CPUs' queues (see StealPolicy). Steals and migrations (a job
+ * running on a different CPU than last time) are counted.
+ */
+class SMPScheduler : public Scheduler {
+public:
+    // `time_quantum` applies to RR only (0 = the RR default of 2)
+    SMPScheduler(const std::string& algorithm, int cpus, DispatchMode mode, int time_quantum = 0);
+    
+    void schedule() override;
+    
+    // Work stealing between per-CPU queues (ignored with GLOBAL dispatch)
+    void set_steal_policy(StealPolicy policy, uint64_t seed = 1);
+    
+    int get_cpu_count() const;
+    DispatchMode get_dispatch_mode() const;
+    StealPolicy get_steal_policy() const;
+    const std::vector<GanttChart>& get_cpu_gantt_charts() const;
+    long long get_steal_count() const;
+    long long get_migration_count() const;
+    
+    // One chart per CPU
+    void print_cpu_gantt_charts() const;
+    void print_smp_stats() const;  // Steals and migrations
+
+private:
+    struct CPU {
+        Process* running;
+        int slice_start;  // Start of the part of the slice not yet accounted
+        int slice_end;    // When the current slice expires
+        int free_since;   // Start of the current idle period
+        
+        CPU() : running(nullptr), slice_start(0), slice_end(0), free_since(0) {}
+    };
+    
+    ReadyOrder order;
+    bool preemptive;   // STCF, EDF: a better waiting job takes over a CPU
+    int time_quantum;  // 0 = run to completion
+    DispatchMode mode;
+    StealPolicy steal_policy;
+    uint64_t steal_seed;
+    std::mt19937_64 steal_rng;
+    std::vector<CPU> cpus;
+    std::vector<ReadyQueue> queues;  // One shared queue (GLOBAL) or one per CPU
+    std::vector<int> last_cpu;       // CPU each process slot last ran on (-1 = never)
+    std::vector<GanttChart> cpu_gantts;
+    long long steals;
+    long long migrations;
+    
+    ReadyQueue& queue_for(size_t cpu);
+    void enqueue(Process* process, size_t cpu);
+    size_t least_loaded_cpu() const;
+    Process* steal_for(size_t thief);
+    
+    // Charge the running job on `cpu` for the time up to `now`
+    void account_until(size_t cpu, int now);
+    void dispatch(size_t cpu, Process* process, int now);
+    void preempt(int now);
+    int next_event(int next_arrival) const;
+};
+
+/**
+ * Factory for SMP schedulers: fcfs/fifo, sjf, stcf/srtf, edf (global EDF) or rr
+ */
+SMPScheduler* create_smp_scheduler(const std::string& algorithm, int cpus,
+                                   DispatchMode mode = DispatchMode::GLOBAL, int time_quantum = 0);
+
+#endif // SMP_H
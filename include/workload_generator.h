@@ -0,0 +1,101 @@
+#ifndef WORKLOAD_GENERATOR_H
+#define WORKLOAD_GENERATOR_H
+
+#include "process.h"
+#include "process_table.h"
+#include <vector>
+#include <string>
+#include <utility>
+#include <random>
+#include <ostream>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Burst length distributions for generated workloads
+ */
+enum class BurstDistribution {
+    EXPONENTIAL,  // Mean burst_mean
+    BIMODAL,      // Mix of short and long exponentials (interactive vs batch)
+    PARETO        // Heavy tail: pareto_min / U^(1/pareto_alpha)
+};
+
+/**
+ * Parameters of a synthetic workload
+ * Arrivals form a Poisson process (exponential inter-arrival times);
+ * bursts are rounded to whole time units and clamped to [1, max_burst].
+ */
+struct WorkloadSpec {
+    size_t count;
+    uint64_t seed;
+    double arrival_rate;         // Mean arrivals per time unit
+    
+    BurstDistribution burst;
+    double burst_mean;           // EXPONENTIAL
+    double short_mean;           // BIMODAL
+    double long_mean;
+    double long_fraction;        // Probability of a long burst
+    double pareto_alpha;         // PARETO
+    double pareto_min;
+    int max_burst;
+    
+    // (priority, weight) pairs; weights need not sum to 1
+    std::vector<std::pair<int, double>> priority_mix;
+    int first_pid;
+    
+    WorkloadSpec();
+    
+    // "exp:MEAN", "bimodal:SHORT:LONG:FRACTION" or "pareto:ALPHA:MIN"
+    void set_burst(const std::string& text);
+    // "PRIO:WEIGHT,PRIO:WEIGHT,..."
+    void set_priority_mix(const std::string& text);
+    
+    // Throws std::runtime_error if any parameter is out of range
+    void validate() const;
+};
+
+/**
+ * Seeded, reproducible workload generator
+ * Uses std::mt19937_64 (whose output sequence is fixed by the standard) and
+ * hand-written inverse-transform sampling instead of <random>'s
+ * distributions, whose results differ between standard libraries. The same
+ * spec and seed therefore give the same workload on every platform.
+ *
+ * Processes are produced one at a time in arrival order, so text output
+ * streams in constant memory.
+ */
+class WorkloadGenerator {
+public:
+    explicit WorkloadGenerator(const WorkloadSpec& spec);
+    
+    bool done() const { return produced >= spec.count; }
+    size_t generated() const { return produced; }
+    
+    // Next process in arrival order; throws if done() or arrivals overflow int
+    Process next();
+    
+    // Whole workload in memory
+    std::vector<Process> generate();
+    ProcessTable generate_table();
+    
+    // Stream "pid arrival burst priority" lines (FileParser grammar)
+    static size_t write_text(const WorkloadSpec& spec, std::ostream& out);
+    static size_t write_text(const WorkloadSpec& spec, const std::string& filename);
+    
+    // Binary columnar file (see BinaryWorkload); builds the table in memory
+    static size_t write_binary(const WorkloadSpec& spec, const std::string& filename);
+
+private:
+    WorkloadSpec spec;
+    std::mt19937_64 rng;
+    std::vector<double> priority_cdf;
+    double clock;
+    size_t produced;
+    
+    double uniform();                    // [0, 1) with 53 random bits
+    double exponential(double mean);
+    int sample_burst();
+    int sample_priority();
+};
+
+#endif // WORKLOAD_GENERATOR_H
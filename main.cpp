@@ -1,25 +1,95 @@
 #include "scheduler.h"
 #include "file_parser.h"
 #include "performance.h"
+#include "gantt_sink.h"
+#include "binary_workload.h"
+#include "experiment.h"
+#include "workload_generator.h"
+#include "smp.h"
 #include <iostream>
 #include <memory>
 #include <string>
+#include <utility>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <sstream>
 
 void print_usage(const std::string& program_name) {
     std::cout << "CPU Scheduling Simulator\n\n";
-    std::cout << "Usage: " << program_name << " <algorithm> <input_file> [options]\n\n";
+    std::cout << "Usage: " << program_name << " <algorithm> <input_file> [options]\n";
+    std::cout << "       " << program_name << " compare <input_file> [algorithms...] [options]\n";
+    std::cout << "       " << program_name << " sweep <input_file> [--quanta MIN:MAX[:STEP]] [options]\n";
+    std::cout << "       " << program_name << " --convert <text_file> <binary_file>\n";
+    std::cout << "       " << program_name << " --generate <output_file|-> [generator options]\n\n";
     std::cout << "Algorithms:\n";
     std::cout << "  fcfs, fifo    - First Come First Serve\n";
     std::cout << "  sjf           - Shortest Job First\n";
     std::cout << "  stcf, srtf    - Shortest Time to Completion First\n";
-    std::cout << "  rr            - Round Robin\n\n";
+    std::cout << "  rr            - Round Robin\n";
+    std::cout << "  priority      - Priority, non-preemptive (lower number = higher priority)\n";
+    std::cout << "  ppriority     - Preemptive Priority (also: priority-preemptive)\n";
+    std::cout << "  mlfq          - Multi-Level Feedback Queue\n";
+    std::cout << "  cfs           - Completely Fair Scheduler (priority = nice value)\n";
+    std::cout << "  lottery       - Lottery, 100 / (1 + priority) tickets per job\n";
+    std::cout << "  stride        - Stride, deterministic proportional share\n";
+    std::cout << "  edf           - Earliest Deadline First, preemptive (also with --cpus)\n";
+    std::cout << "  edf-np        - Earliest Deadline First, non-preemptive\n\n";
+    std::cout << "Modes:\n";
+    std::cout << "  compare       - Run several algorithms in parallel on one workload\n";
+    std::cout << "                  (default: fcfs sjf stcf rr) and print a side-by-side table\n";
+    std::cout << "  sweep         - Run Round Robin over a range of quanta in parallel\n";
+    std::cout << "                  (default: 1:20) and report the best one\n\n";
     std::cout << "Options:\n";
     std::cout << "  --no-gantt    - Don't display Gantt chart\n";
     std::cout << "  --detailed    - Show detailed performance metrics\n";
+    std::cout << "  --compact-gantt - Store the Gantt chart in compact form\n";
+    std::cout << "  --metrics-only  - Keep only online timeline metrics, not the chart\n";
+    std::cout << "  --gantt-file F  - Stream Gantt slices to file F instead of memory\n";
+    std::cout << "  --fast-parse    - Memory-map the input and report parse throughput\n";
+    std::cout << "  --parse-threads N - Parse the input on N threads (0 = all cores)\n";
+    std::cout << "  --quantum N     - RR, lottery and stride quantum, or the MLFQ top-level quantum (default: 2)\n";
+    std::cout << "  --seed S        - Lottery RNG seed (default: 1)\n";
+    std::cout << "  --aging N       - Priority aging: one level per N time units waited (default: 10, 0 = off)\n";
+    std::cout << "  --levels N      - MLFQ levels; quanta double per level (default: 3)\n";
+    std::cout << "  --level-quanta L - MLFQ quanta per level, e.g. 2,4,8 (overrides --levels)\n";
+    std::cout << "  --boost T       - MLFQ priority boost every T time units (default: 100, 0 = off)\n";
+    std::cout << "  --target-latency N - CFS scheduling period target (default: 20)\n";
+    std::cout << "  --min-granularity N - CFS minimum slice (default: 2)\n";
+    std::cout << "  --horizon H     - Release periodic tasks every period until time H\n";
+    std::cout << "  --switch-cost N - Charge N time units per context switch (default: 0)\n";
+    std::cout << "  --cache-penalty P - Extra switch cost of up to P for a cold cache (default: 0)\n";
+    std::cout << "  --cache-decay T - Time off the CPU until the cache is fully cold (default: 1)\n";
+    std::cout << "  --cpus N        - Simulate N CPUs (per-CPU Gantt charts and utilization)\n";
+    std::cout << "  --dispatch M    - Multi-CPU ready queues: global (default) or per-cpu\n";
+    std::cout << "  --steal P       - Per-CPU work stealing: none (default), busiest or random\n";
+    std::cout << "  --steal-seed S  - Seed for random stealing (default: 1)\n";
+    std::cout << "  --quanta A:B[:S] - Sweep quanta A to B in steps of S\n";
+    std::cout << "  --objective X   - Sweep objective: waiting, response, turnaround, switches\n";
+    std::cout << "  --threads N     - Sweep worker threads (0 = all cores)\n";
     std::cout << "  --help        - Show this help message\n\n";
+    std::cout << "Generator options:\n";
+    std::cout << "  --count N       - Number of processes (default: 1000)\n";
+    std::cout << "  --seed S        - RNG seed; the same seed gives the same workload\n";
+    std::cout << "  --arrival-rate R - Mean Poisson arrivals per time unit (default: 0.5)\n";
+    std::cout << "  --burst SPEC    - exp:MEAN, bimodal:SHORT:LONG:FRACTION or pareto:ALPHA:MIN\n";
+    std::cout << "  --max-burst B   - Clamp bursts to B time units (default: 1000000)\n";
+    std::cout << "  --priorities M  - Priority mix PRIO:WEIGHT,... (default: 1-5 uniform)\n";
+    std::cout << "  --binary        - Write the binary workload format instead of text\n\n";
     std::cout << "Examples:\n";
     std::cout << "  " << program_name << " fcfs test_data/simple.txt\n";
     std::cout << "  " << program_name << " rr test_data/interactive.txt --detailed\n";
+    std::cout << "  " << program_name << " rr test_data/interactive.txt --quantum 4\n";
+    std::cout << "  " << program_name << " priority-preemptive test_data/priority.txt --aging 5\n";
+    std::cout << "  " << program_name << " mlfq test_data/interactive.txt --level-quanta 1,4,16 --boost 40\n";
+    std::cout << "  " << program_name << " edf test_data/realtime.txt --horizon 120\n";
+    std::cout << "  " << program_name << " sweep test_data/mixed.txt --switch-cost 1 --objective turnaround\n";
+    std::cout << "  " << program_name << " stcf test_data/mixed.txt --cpus 2 --dispatch per-cpu\n";
+    std::cout << "  " << program_name << " rr trace.bin --cpus 16 --steal busiest --no-gantt\n";
+    std::cout << "  " << program_name << " compare test_data/mixed.txt fcfs sjf rr\n";
+    std::cout << "  " << program_name << " sweep test_data/mixed.txt --quanta 1:50 --objective response\n";
+    std::cout << "  " << program_name << " --convert trace.txt trace.bin\n";
+    std::cout << "  " << program_name << " --generate big.txt --count 1000000 --burst pareto:1.2:2 --seed 7\n";
 }
 
 int main(int argc, char* argv[]) {
@@ -43,6 +113,73 @@ int main(int argc, char* argv[]) {
         return 0;
     }
     
+    if (algorithm == "--convert") {
+        if (argc < 4) {
+            std::cerr << "Error: --convert needs a text input file and a binary output file\n";
+            return 1;
+        }
+        try {
+            size_t count = BinaryWorkload::convert_text(argv[2], argv[3]);
+            std::cout << "Wrote " << count << " processes to " << argv[3] << "\n";
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
+    
+    if (algorithm == "--generate") {
+        if (argc < 3) {
+            std::cerr << "Error: --generate needs an output file (or - for stdout)\n";
+            return 1;
+        }
+        std::string output = argv[2];
+        bool binary = false;
+        try {
+            WorkloadSpec spec;
+            for (int i = 3; i < argc; i++) {
+                std::string arg = argv[i];
+                if (arg == "--binary") {
+                    binary = true;
+                } else if (i + 1 >= argc) {
+                    std::cerr << "Warning: Unknown option " << arg << "\n";
+                } else if (arg == "--count") {
+                    spec.count = std::strtoull(argv[++i], nullptr, 10);
+                } else if (arg == "--seed") {
+                    spec.seed = std::strtoull(argv[++i], nullptr, 10);
+                } else if (arg == "--arrival-rate") {
+                    spec.arrival_rate = std::atof(argv[++i]);
+                } else if (arg == "--burst") {
+                    spec.set_burst(argv[++i]);
+                } else if (arg == "--max-burst") {
+                    spec.max_burst = std::atoi(argv[++i]);
+                } else if (arg == "--priorities") {
+                    spec.set_priority_mix(argv[++i]);
+                } else {
+                    std::cerr << "Warning: Unknown option " << arg << "\n";
+                }
+            }
+            
+            if (binary) {
+                if (output == "-") {
+                    std::cerr << "Error: binary output needs a file name\n";
+                    return 1;
+                }
+                size_t count = WorkloadGenerator::write_binary(spec, output);
+                std::cerr << "Wrote " << count << " processes to " << output << "\n";
+            } else if (output == "-") {
+                WorkloadGenerator::write_text(spec, std::cout);
+            } else {
+                size_t count = WorkloadGenerator::write_text(spec, output);
+                std::cerr << "Wrote " << count << " processes to " << output << "\n";
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
+    
     if (argc < 3) {
         std::cerr << "Error: Input file required\n";
         print_usage(argv[0]);
@@ -54,13 +191,163 @@ int main(int argc, char* argv[]) {
     // Parse command line options
     bool show_gantt = true;
     bool detailed_metrics = false;
+    bool compact_gantt = false;
+    bool metrics_only = false;
+    std::string gantt_file;
+    bool fast_parse = false;
+    int parse_threads = -1;  // -1 = single-threaded
+    const bool compare_mode = (algorithm == "compare");
+    std::vector<std::string> compare_algorithms;
+    const bool sweep_mode = (algorithm == "sweep");
+    int quantum = 0;  // 0 = scheduler default
+    int aging = -1;   // -1 = scheduler default
+    int mlfq_levels = 0;  // 0 = scheduler default
+    std::vector<int> level_quanta;
+    int boost = -1;       // -1 = scheduler default
+    int horizon = 0;      // 0 = periodic tasks release once
+    SwitchCost switch_cost;   // Free by default
+    unsigned long long lottery_seed = 1;
+    bool lottery_seed_given = false;
+    int target_latency = 0;   // 0 = scheduler default
+    int min_granularity = 0;
+    int quantum_min = 1, quantum_max = 20, quantum_step = 1;
+    std::string objective = "waiting";
+    int sweep_threads = 0;
+    int cpu_count = 0;  // 0 = classic single-CPU schedulers
+    DispatchMode dispatch = DispatchMode::GLOBAL;
+    bool dispatch_given = false;
+    StealPolicy steal = StealPolicy::NONE;
+    unsigned long long steal_seed = 1;
     
     for (int i = 3; i < argc; i++) {
         std::string arg = argv[i];
-        if (arg == "--no-gantt") {
+        if (compare_mode && arg.compare(0, 2, "--") != 0) {
+            compare_algorithms.push_back(arg);
+        } else if (arg == "--no-gantt") {
             show_gantt = false;
         } else if (arg == "--detailed") {
             detailed_metrics = true;
+        } else if (arg == "--compact-gantt") {
+            compact_gantt = true;
+        } else if (arg == "--metrics-only") {
+            metrics_only = true;
+        } else if (arg == "--gantt-file" && i + 1 < argc) {
+            gantt_file = argv[++i];
+        } else if (arg == "--fast-parse") {
+            fast_parse = true;
+        } else if (arg == "--parse-threads" && i + 1 < argc) {
+            parse_threads = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--quantum" && i + 1 < argc) {
+            quantum = std::atoi(argv[++i]);
+            if (quantum <= 0) {
+                std::cerr << "Error: --quantum must be a positive integer\n";
+                return 1;
+            }
+        } else if (arg == "--aging" && i + 1 < argc) {
+            aging = std::atoi(argv[++i]);
+            if (aging < 0) {
+                std::cerr << "Error: --aging must be a non-negative integer\n";
+                return 1;
+            }
+        } else if (arg == "--levels" && i + 1 < argc) {
+            mlfq_levels = std::atoi(argv[++i]);
+            if (mlfq_levels <= 0) {
+                std::cerr << "Error: --levels must be a positive integer\n";
+                return 1;
+            }
+        } else if (arg == "--level-quanta" && i + 1 < argc) {
+            level_quanta.clear();
+            std::stringstream list(argv[++i]);
+            std::string item;
+            while (std::getline(list, item, ',')) {
+                level_quanta.push_back(std::atoi(item.c_str()));
+            }
+        } else if (arg == "--boost" && i + 1 < argc) {
+            boost = std::atoi(argv[++i]);
+            if (boost < 0) {
+                std::cerr << "Error: --boost must be a non-negative integer\n";
+                return 1;
+            }
+        } else if (arg == "--horizon" && i + 1 < argc) {
+            horizon = std::atoi(argv[++i]);
+            if (horizon <= 0) {
+                std::cerr << "Error: --horizon must be a positive integer\n";
+                return 1;
+            }
+        } else if (arg == "--switch-cost" && i + 1 < argc) {
+            switch_cost.dispatch = std::atoi(argv[++i]);
+            if (switch_cost.dispatch < 0) {
+                std::cerr << "Error: --switch-cost must be a non-negative integer\n";
+                return 1;
+            }
+        } else if (arg == "--cache-penalty" && i + 1 < argc) {
+            switch_cost.cache_penalty = std::atoi(argv[++i]);
+            if (switch_cost.cache_penalty < 0) {
+                std::cerr << "Error: --cache-penalty must be a non-negative integer\n";
+                return 1;
+            }
+        } else if (arg == "--cache-decay" && i + 1 < argc) {
+            switch_cost.cache_decay = std::atoi(argv[++i]);
+            if (switch_cost.cache_decay <= 0) {
+                std::cerr << "Error: --cache-decay must be a positive integer\n";
+                return 1;
+            }
+        } else if (arg == "--seed" && i + 1 < argc) {
+            lottery_seed = std::strtoull(argv[++i], nullptr, 10);
+            lottery_seed_given = true;
+        } else if (arg == "--target-latency" && i + 1 < argc) {
+            target_latency = std::atoi(argv[++i]);
+            if (target_latency <= 0) {
+                std::cerr << "Error: --target-latency must be a positive integer\n";
+                return 1;
+            }
+        } else if (arg == "--min-granularity" && i + 1 < argc) {
+            min_granularity = std::atoi(argv[++i]);
+            if (min_granularity <= 0) {
+                std::cerr << "Error: --min-granularity must be a positive integer\n";
+                return 1;
+            }
+        } else if (arg == "--quanta" && i + 1 < argc) {
+            quantum_step = 1;
+            if (std::sscanf(argv[++i], "%d:%d:%d", &quantum_min, &quantum_max, &quantum_step) < 2) {
+                std::cerr << "Error: --quanta expects MIN:MAX or MIN:MAX:STEP\n";
+                return 1;
+            }
+        } else if (arg == "--objective" && i + 1 < argc) {
+            objective = argv[++i];
+        } else if (arg == "--cpus" && i + 1 < argc) {
+            cpu_count = std::atoi(argv[++i]);
+            if (cpu_count <= 0) {
+                std::cerr << "Error: --cpus must be a positive integer\n";
+                return 1;
+            }
+        } else if (arg == "--dispatch" && i + 1 < argc) {
+            std::string mode = argv[++i];
+            if (mode == "global") {
+                dispatch = DispatchMode::GLOBAL;
+            } else if (mode == "per-cpu") {
+                dispatch = DispatchMode::PER_CPU;
+            } else {
+                std::cerr << "Error: --dispatch must be global or per-cpu\n";
+                return 1;
+            }
+            dispatch_given = true;
+        } else if (arg == "--steal" && i + 1 < argc) {
+            std::string policy = argv[++i];
+            if (policy == "none") {
+                steal = StealPolicy::NONE;
+            } else if (policy == "busiest") {
+                steal = StealPolicy::BUSIEST;
+            } else if (policy == "random") {
+                steal = StealPolicy::RANDOM;
+            } else {
+                std::cerr << "Error: --steal must be none, busiest or random\n";
+                return 1;
+            }
+        } else if (arg == "--steal-seed" && i + 1 < argc) {
+            steal_seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            sweep_threads = std::max(0, std::atoi(argv[++i]));
         } else {
             std::cerr << "Warning: Unknown option " << arg << "\n";
         }
@@ -69,25 +356,150 @@ int main(int argc, char* argv[]) {
     try {
         // Load processes from file
         std::cout << "Loading processes from: " << input_file << "\n";
-        std::vector<Process> processes = FileParser::parse_file(input_file);
-        std::cout << "Loaded " << processes.size() << " processes\n\n";
+        std::vector<Process> processes;
+        if (BinaryWorkload::is_binary_file(input_file)) {
+            processes = BinaryWorkload::load(input_file);
+        } else if (fast_parse || parse_threads >= 0) {
+            ParseStats stats;
+            if (parse_threads >= 0) {
+                processes = FileParser::parse_file_parallel(input_file, parse_threads, &stats);
+            } else {
+                processes = FileParser::parse_file_fast(input_file, &stats);
+            }
+            std::cout << "Parsed " << stats.lines << " lines in " << stats.seconds * 1000.0
+                      << " ms on " << stats.threads << " thread(s) ("
+                      << static_cast<long long>(stats.lines_per_second()) << " lines/s)\n";
+        } else {
+            processes = FileParser::parse_file(input_file);
+        }
+        std::cout << "Loaded " << processes.size() << " processes\n";
+        if (horizon > 0) {
+            processes = FileParser::expand_periodic(processes, horizon);
+            std::cout << "Expanded periodic tasks to " << processes.size() << " jobs before time "
+                      << horizon << "\n";
+        } else if (std::any_of(processes.begin(), processes.end(),
+                               [](const Process& p) { return p.period > 0; })) {
+            std::cerr << "Warning: periodic tasks release only once without --horizon\n";
+        }
+        std::cout << "\n";
+        
+        if (compare_mode) {
+            if (compare_algorithms.empty()) {
+                compare_algorithms = {"fcfs", "sjf", "stcf", "rr"};
+            }
+            ExperimentRunner::print_comparison(
+                ExperimentRunner::compare_algorithms(processes, compare_algorithms, switch_cost));
+            return 0;
+        }
+        
+        if (sweep_mode) {
+            SweepObjective goal = ExperimentRunner::parse_objective(objective);
+            ExperimentRunner::print_sweep(
+                ExperimentRunner::sweep_round_robin(processes, quantum_min, quantum_max, quantum_step,
+                                                    static_cast<unsigned>(sweep_threads), switch_cost),
+                goal);
+            return 0;
+        }
         
         // Create scheduler
-        std::unique_ptr<Scheduler> scheduler(create_scheduler(algorithm));
+        const bool share_algorithm = (algorithm == "lottery" || algorithm == "stride");
+        if (quantum > 0 && algorithm != "rr" && algorithm != "mlfq" && !share_algorithm) {
+            std::cerr << "Warning: --quantum only applies to rr, mlfq, lottery and stride\n";
+        }
+        if (lottery_seed_given && algorithm != "lottery") {
+            std::cerr << "Warning: --seed only applies to lottery\n";
+        }
+        const bool cfs_options = (target_latency > 0 || min_granularity > 0);
+        if (cfs_options && algorithm != "cfs") {
+            std::cerr << "Warning: --target-latency and --min-granularity only apply to cfs\n";
+        }
+        const bool mlfq_options = (mlfq_levels > 0 || !level_quanta.empty() || boost >= 0);
+        if (mlfq_options && algorithm != "mlfq") {
+            std::cerr << "Warning: --levels, --level-quanta and --boost only apply to mlfq\n";
+        }
+        const bool priority_algorithm = (algorithm == "priority" || algorithm == "priority-preemptive" ||
+                                         algorithm == "ppriority");
+        if (aging >= 0 && !priority_algorithm) {
+            std::cerr << "Warning: --aging only applies to the priority schedulers\n";
+        }
+        std::unique_ptr<Scheduler> scheduler;
+        SMPScheduler* smp = nullptr;
+        if (cpu_count > 0) {
+            if (steal != StealPolicy::NONE && !dispatch_given) {
+                dispatch = DispatchMode::PER_CPU;  // Stealing needs per-CPU queues
+            } else if (steal != StealPolicy::NONE && dispatch == DispatchMode::GLOBAL) {
+                std::cerr << "Warning: --steal has no effect with --dispatch global\n";
+            }
+            smp = create_smp_scheduler(algorithm, cpu_count, dispatch, quantum);
+            smp->set_steal_policy(steal, steal_seed);
+            scheduler.reset(smp);
+            if (!gantt_file.empty() || metrics_only) {
+                std::cerr << "Warning: --gantt-file and --metrics-only are ignored with --cpus\n";
+                gantt_file.clear();
+                metrics_only = false;
+            }
+            if (switch_cost.enabled()) {
+                std::cerr << "Warning: context-switch costs are ignored with --cpus\n";
+            }
+        } else if (quantum > 0 && algorithm == "rr") {
+            scheduler.reset(create_round_robin_scheduler(quantum));
+        } else if (algorithm == "mlfq" && (mlfq_options || quantum > 0)) {
+            // Without an explicit list, quanta double from the top level down
+            if (level_quanta.empty()) {
+                const int levels = mlfq_levels > 0 ? mlfq_levels : 3;
+                for (int level = 0; level < levels; level++) {
+                    level_quanta.push_back((quantum > 0 ? quantum : 2) << std::min(level, 20));
+                }
+            }
+            scheduler.reset(create_mlfq_scheduler(level_quanta, boost));
+        } else if (algorithm == "lottery" && (quantum > 0 || lottery_seed_given)) {
+            scheduler.reset(create_lottery_scheduler(quantum > 0 ? quantum : 2, lottery_seed));
+        } else if (algorithm == "stride" && quantum > 0) {
+            scheduler.reset(create_stride_scheduler(quantum));
+        } else if (algorithm == "cfs" && cfs_options) {
+            scheduler.reset(create_cfs_scheduler(target_latency > 0 ? target_latency : 20,
+                                                 min_granularity > 0 ? min_granularity : 2));
+        } else if (aging >= 0 && priority_algorithm) {
+            scheduler.reset(create_priority_scheduler(algorithm != "priority", aging));
+        } else {
+            scheduler.reset(create_scheduler(algorithm));
+        }
+        
+        // Pick where the timeline goes: the in-memory chart or a streaming sink
+        std::unique_ptr<GanttMetricsSink> sink;
+        if (!gantt_file.empty()) {
+            sink.reset(new FileGanttSink(gantt_file));
+        } else if (metrics_only) {
+            sink.reset(new GanttMetricsSink());
+        }
+        scheduler->set_gantt_sink(sink.get());
         
         // Load processes and run simulation
-        scheduler->load_processes(processes);
+        scheduler->set_compact_gantt(compact_gantt);
+        scheduler->set_switch_cost(switch_cost);
+        scheduler->load_processes(std::move(processes));
         scheduler->schedule();
         
         // Display results
         scheduler->print_results();
         
-        if (show_gantt) {
+        if (show_gantt && smp) {
+            smp->print_cpu_gantt_charts();
+        } else if (show_gantt && !sink) {
             scheduler->print_gantt_chart();
         }
         
-        // Calculate and display performance metrics
-        PerformanceMetrics metrics(scheduler->get_processes(), scheduler->get_gantt_chart());
+        // Calculate and display performance metrics (views; nothing is copied)
+        PerformanceMetrics metrics = smp
+            ? PerformanceMetrics::view(scheduler->get_processes(), smp->get_cpu_gantt_charts())
+            : sink
+            ? PerformanceMetrics::view(scheduler->get_processes(), sink->summary())
+            : PerformanceMetrics::view(scheduler->get_processes(), scheduler->get_gantt_chart());
+        
+        if (!gantt_file.empty()) {
+            static_cast<FileGanttSink*>(sink.get())->flush();
+            std::cout << "\nGantt chart written to: " << gantt_file << "\n";
+        }
         
         if (detailed_metrics) {
             metrics.print_detailed();
@@ -95,6 +507,20 @@ int main(int argc, char* argv[]) {
             metrics.print_summary();
         }
         
+        if (smp) {
+            smp->print_smp_stats();
+        }
+        if (share_algorithm) {
+            metrics.print_share_report(detailed_metrics);
+        }
+        if (std::any_of(scheduler->get_processes().begin(), scheduler->get_processes().end(),
+                        [](const Process& p) { return p.has_deadline(); })) {
+            metrics.print_deadline_report();
+        }
+        if (metrics.get_total_io_time() > 0) {
+            metrics.print_io_report();
+        }
+        
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << "\n";
         return 1;
@@ -3,109 +3,346 @@
 #include <iomanip>
 #include <algorithm>
 #include <numeric>
+#include <cmath>
+#include <unordered_map>
 
-PerformanceMetrics::PerformanceMetrics(const std::vector<Process>& procs, const GanttChart& chart)
-    : processes(procs), gantt(chart) {}
+namespace {
 
-double PerformanceMetrics::calculate_average_turnaround_time() const {
-    // EXAMPLE IMPLEMENTATION - [demo in class]
+// Shares nothing: the pointer only refers to the caller's vector
+std::shared_ptr<const std::vector<Process> > make_view(const std::vector<Process>& procs) {
+    return std::shared_ptr<const std::vector<Process> >(std::shared_ptr<void>(), &procs);
+}
+
+std::vector<GanttSummary> summarize_all(const std::vector<GanttChart>& charts) {
+    std::vector<GanttSummary> summaries;
+    summaries.reserve(charts.size());
+    for (const auto& chart : charts) {
+        summaries.push_back(chart.summarize());
+    }
+    return summaries;
+}
+
+// Share of CPU time that went to the wrong jobs (0 = exact proportional share).
+// Weighted by time, so short jobs with tiny entitlements do not dominate.
+double share_error(const std::vector<ShareRecord>& shares) {
+    double misallocated = 0.0;
+    double received = 0.0;
+    for (const auto& record : shares) {
+        misallocated += std::abs(record.received - record.entitled);
+        received += record.received;
+    }
+    return received > 0.0 ? misallocated / received : 0.0;
+}
+
+// Change in runnable tickets or in CPU gaps (idle/overhead) at a time
+struct ShareEvent {
+    int time;
+    int tickets;
+    int gaps;
     
-    if (processes.empty()) return 0.0;
+    ShareEvent(int t, int d, int g) : time(t), tickets(d), gaps(g) {}
+    
+    bool operator<(const ShareEvent& other) const { return time < other.time; }
+};
 
-    double total_tat = 0.0;
-    for (const auto& p : processes) {
-        total_tat += p.turnaround_time;   // turnaround = completion - arrival
+} // namespace
+
+PerformanceMetrics::PerformanceMetrics(const std::vector<Process>& procs, const GanttChart& chart)
+    : processes(std::make_shared<const std::vector<Process> >(procs)), timeline(chart.summarize()) {
+    compute();
+    collect_share_gaps(chart);
+}
+
+PerformanceMetrics::PerformanceMetrics(const std::vector<Process>& procs, const GanttSummary& summary)
+    : processes(std::make_shared<const std::vector<Process> >(procs)), timeline(summary) {
+    compute();
+}
+
+PerformanceMetrics::PerformanceMetrics(std::shared_ptr<const std::vector<Process> > procs,
+                                       const GanttSummary& summary)
+    : processes(procs), timeline(summary) {
+    compute();
+}
+
+PerformanceMetrics::PerformanceMetrics(const std::vector<Process>& procs,
+                                       const std::vector<GanttChart>& cpu_charts)
+    : PerformanceMetrics(std::make_shared<const std::vector<Process> >(procs), summarize_all(cpu_charts)) {}
+
+PerformanceMetrics::PerformanceMetrics(std::shared_ptr<const std::vector<Process> > procs,
+                                       const std::vector<GanttSummary>& per_cpu)
+    : processes(procs), timeline(GanttSummary::combine(per_cpu)), cpu_timelines(per_cpu) {
+    compute();
+}
+
+PerformanceMetrics PerformanceMetrics::view(const std::vector<Process>& procs, const GanttChart& chart) {
+    PerformanceMetrics metrics(make_view(procs), chart.summarize());
+    metrics.collect_share_gaps(chart);
+    return metrics;
+}
+
+PerformanceMetrics PerformanceMetrics::view(const std::vector<Process>& procs, const GanttSummary& summary) {
+    return PerformanceMetrics(make_view(procs), summary);
+}
+
+PerformanceMetrics PerformanceMetrics::view(const std::vector<Process>& procs,
+                                            const std::vector<GanttChart>& cpu_charts) {
+    return PerformanceMetrics(make_view(procs), summarize_all(cpu_charts));
+}
+
+void PerformanceMetrics::collect_share_gaps(const GanttChart& chart) {
+    share_gaps = chart.get_io_entries();
+    for (const auto& entry : chart) {
+        if (entry.is_idle() || entry.is_overhead()) {
+            share_gaps.push_back(entry);
+        }
     }
-    return total_tat / processes.size();
-    return 0.0; // Placeholder implementation
 }
 
-double PerformanceMetrics::calculate_average_waiting_time() const {
-    if (processes.empty()) return 0.0;
+const MetricsSummary& PerformanceMetrics::summary() const {
+    return totals;
+}
 
+void PerformanceMetrics::compute() {
+    // One fused pass gathers every per-process sum the metrics need
+    double total_tat = 0.0;
     double total_wait = 0.0;
-    for (const auto& p : processes) {
-        total_wait += p.waiting_time;   // already computed via Process::calculate_metrics()
+    double total_resp = 0.0;
+    double sum_w2 = 0.0;
+    int completed = 0;
+    bool valid = true;
+    
+    for (const auto& p : *processes) {
+        total_tat  += p.turnaround_time;   // turnaround = completion - arrival
+        total_wait += p.waiting_time;      // already computed via Process::calculate_metrics()
+        total_resp += p.response_time;     // start_time - arrival_time
+        sum_w2 += static_cast<double>(p.waiting_time) * p.waiting_time;
+        if (p.completion_time >= 0) ++completed;
+        
+        if (p.start_time < 0 || p.completion_time < 0 ||
+            p.completion_time < p.start_time || p.start_time < p.arrival_time) {
+            valid = false;
+        }
+    }
+    
+    const int n = static_cast<int>(processes->size());
+    totals = MetricsSummary();
+    totals.total_processes = n;
+    totals.completed_processes = completed;
+    totals.valid = valid;
+    totals.total_time = timeline.total_time;
+    totals.context_switches = timeline.context_switches;
+    totals.cpu_utilization = timeline.cpu_utilization();
+    
+    if (n > 0) {
+        totals.average_turnaround_time = total_tat / n;
+        totals.average_waiting_time = total_wait / n;
+        totals.average_response_time = total_resp / n;
+        
+        // Jain's fairness index over waiting times (all zero -> perfectly fair)
+        if (sum_w2 > 0.0) {
+            totals.fairness_index = (total_wait * total_wait) / (static_cast<double>(n) * sum_w2);
+        }
+    }
+    
+    // Use reported total time from Gantt (already accounts for idle time)
+    if (completed > 0 && timeline.total_time > 0) {
+        totals.throughput = static_cast<double>(completed) / static_cast<double>(timeline.total_time);
     }
-    return total_wait / processes.size();
 }
 
+double PerformanceMetrics::calculate_average_turnaround_time() const {
+    return totals.average_turnaround_time;
+}
 
-double PerformanceMetrics::calculate_average_response_time() const {
-    if (processes.empty()) return 0.0;
+double PerformanceMetrics::calculate_average_waiting_time() const {
+    return totals.average_waiting_time;
+}
 
-    double total_resp = 0.0;
-    for (const auto& p : processes) {
-        total_resp += p.response_time;  // start_time - arrival_time
-    }
-    return total_resp / processes.size();
+double PerformanceMetrics::calculate_average_response_time() const {
+    return totals.average_response_time;
 }
 
 double PerformanceMetrics::calculate_cpu_utilization() const {
-    // TODO: Implement CPU utilization calculation
-    // 
     // CPU Utilization = (Total CPU busy time / Total time) * 100
-    // 
-    // You can use gantt.get_cpu_utilization() or calculate manually:
-    // - Total time = gantt.get_total_time()
-    // - Idle time = gantt.get_total_idle_time()
-    // - Busy time = Total time - Idle time
-    // 
-    // Hint: The GanttChart class already has this functionality
-    
-    return gantt.get_cpu_utilization();  // This is already implemented
+    // Busy time = Total time - Idle time, both taken from the timeline summary
+    return totals.cpu_utilization;
 }
 
 double PerformanceMetrics::calculate_throughput() const {
-    if (processes.empty()) return 0.0;
+    return totals.throughput;
+}
 
-    int completed = 0;
-    for (const auto& p : processes) {
-        if (p.completion_time >= 0) ++completed;
-    }
-    if (completed == 0) return 0.0;
+double PerformanceMetrics::calculate_fairness_index() const {
+    return totals.fairness_index;
+}
 
-    // Use reported total time from Gantt (already accounts for idle time)
-    const int total_time = gantt.get_total_time();
-    if (total_time <= 0) return 0.0;
+int PerformanceMetrics::get_cpu_count() const {
+    return timeline.cpus;
+}
 
-    return static_cast<double>(completed) / static_cast<double>(total_time);
+double PerformanceMetrics::calculate_cpu_utilization(int cpu) const {
+    if (cpu_timelines.empty()) {
+        return cpu == 0 ? totals.cpu_utilization : 0.0;
+    }
+    if (cpu < 0 || cpu >= static_cast<int>(cpu_timelines.size()) || timeline.total_time == 0) {
+        return 0.0;
+    }
+    // Time after a CPU's last slice counts as idle, as in the combined figure
+    return static_cast<double>(get_cpu_busy_time(cpu)) / timeline.total_time * 100.0;
 }
 
-double PerformanceMetrics::calculate_fairness_index() const {
-    const int n = static_cast<int>(processes.size());
-    if (n == 0) return 1.0;  // trivially fair
+int PerformanceMetrics::get_cpu_busy_time(int cpu) const {
+    if (cpu_timelines.empty()) {
+        return cpu == 0 ? timeline.total_time - timeline.idle_time - timeline.overhead_time : 0;
+    }
+    if (cpu < 0 || cpu >= static_cast<int>(cpu_timelines.size())) return 0;
+    return cpu_timelines[cpu].total_time - cpu_timelines[cpu].idle_time;
+}
 
-    double sum_w = 0.0;
-    double sum_w2 = 0.0;
-    for (const auto& p : processes) {
-        const double w = static_cast<double>(p.waiting_time);
-        sum_w  += w;
-        sum_w2 += w * w;
+double PerformanceMetrics::calculate_load_imbalance() const {
+    const int cpus = std::max(1, static_cast<int>(cpu_timelines.size()));
+    long long total_busy = 0;
+    int max_busy = 0;
+    for (int cpu = 0; cpu < cpus; cpu++) {
+        int busy = get_cpu_busy_time(cpu);
+        total_busy += busy;
+        max_busy = std::max(max_busy, busy);
     }
+    if (total_busy == 0) return 1.0;
+    return static_cast<double>(max_busy) * cpus / static_cast<double>(total_busy);
+}
 
-    if (sum_w2 <= 0.0) return 1.0; // all waits zero -> perfectly fair
-    return (sum_w * sum_w) / (static_cast<double>(n) * sum_w2);
+std::vector<ShareRecord> PerformanceMetrics::calculate_shares() const {
+    // Sweep the events in time order. Between events every runnable job is
+    // entitled to tickets / total_tickets of the CPU while it runs a job, so
+    // a running integral of 1 / total_tickets over busy time gives a job's
+    // entitlement as tickets * (integral at the end of each runnable span -
+    // integral at its start).
+    std::unordered_map<int, int> tickets_of;  // Completed jobs only
+    std::vector<ShareEvent> events;
+    for (const auto& p : *processes) {
+        if (p.completion_time < 0) continue;
+        const int tickets = share_tickets(p.priority);
+        tickets_of[p.pid] = tickets;
+        events.push_back(ShareEvent(p.arrival_time, tickets, 0));
+        events.push_back(ShareEvent(p.completion_time, -tickets, 0));
+    }
+    for (const auto& gap : share_gaps) {
+        if (gap.pid < 0) {
+            events.push_back(ShareEvent(gap.start_time, 0, 1));  // CPU not running a job
+            events.push_back(ShareEvent(gap.end_time, 0, -1));
+        } else if (tickets_of.count(gap.pid)) {
+            events.push_back(ShareEvent(gap.start_time, -tickets_of[gap.pid], 0));  // Blocked on I/O
+            events.push_back(ShareEvent(gap.end_time, tickets_of[gap.pid], 0));
+        }
+    }
+    std::sort(events.begin(), events.end());
+    
+    std::vector<int> times;
+    std::vector<double> integral;  // Of 1 / total_tickets over busy time, up to times[i]
+    long long present = 0;
+    int gaps = 0;
+    double acc = 0.0;
+    for (size_t i = 0; i < events.size(); i++) {
+        if (times.empty() || times.back() != events[i].time) {
+            if (!times.empty() && present > 0 && gaps == 0) {
+                acc += static_cast<double>(events[i].time - times.back()) / present;
+            }
+            times.push_back(events[i].time);
+            integral.push_back(acc);
+        }
+        present += events[i].tickets;
+        gaps += events[i].gaps;
+    }
+    
+    auto integral_at = [&](int time) {
+        return integral[std::lower_bound(times.begin(), times.end(), time) - times.begin()];
+    };
+    
+    // I/O waits per job, to take out of its arrival-to-completion span
+    std::unordered_map<int, double> blocked;
+    for (const auto& gap : share_gaps) {
+        if (gap.pid >= 0) {
+            blocked[gap.pid] += integral_at(gap.end_time) - integral_at(gap.start_time);
+        }
+    }
+    
+    std::vector<ShareRecord> shares;
+    for (const auto& p : *processes) {
+        if (p.completion_time < 0) continue;
+        ShareRecord record;
+        record.pid = p.pid;
+        record.tickets = share_tickets(p.priority);
+        double span = integral_at(p.completion_time) - integral_at(p.arrival_time);
+        if (p.has_io()) {
+            auto it = blocked.find(p.pid);
+            if (it != blocked.end()) span -= it->second;
+        }
+        record.entitled = record.tickets * span;
+        record.received = p.burst_time - p.remaining_time;
+        shares.push_back(record);
+    }
+    return shares;
 }
 
+double PerformanceMetrics::calculate_share_error() const {
+    return share_error(calculate_shares());
+}
 
-int PerformanceMetrics::calculate_context_switches() const {
-    // BONUS: Count number of times CPU switches between different processes
-    // 
-    // Look at gantt chart entries and count transitions between different PIDs
-    // Don't count idle time as a context switch
-    
-    const auto& entries = gantt.get_entries();
-    if (entries.size() <= 1) return 0;
-    
-    int switches = 0;
-    for (size_t i = 1; i < entries.size(); i++) {
-        if (!entries[i-1].is_idle() && !entries[i].is_idle() && 
-            entries[i-1].pid != entries[i].pid) {
-            switches++;
+DeadlineStats PerformanceMetrics::calculate_deadline_stats() const {
+    DeadlineStats stats;
+    std::vector<int> tardiness;
+    long long total_tardiness = 0;
+    
+    for (const auto& p : *processes) {
+        if (!p.has_deadline() || p.completion_time < 0) continue;
+        const int lateness = p.completion_time - p.deadline;
+        if (stats.jobs == 0 || lateness > stats.max_lateness) {
+            stats.max_lateness = lateness;
+        }
+        stats.jobs++;
+        if (lateness > 0) {
+            stats.missed++;
+            total_tardiness += lateness;
         }
+        tardiness.push_back(std::max(0, lateness));
     }
-    return switches;
+    if (stats.jobs == 0) return stats;
+    
+    stats.miss_ratio = static_cast<double>(stats.missed) / stats.jobs;
+    stats.mean_tardiness = static_cast<double>(total_tardiness) / stats.jobs;
+    stats.max_tardiness = std::max(0, stats.max_lateness);
+    
+    // O(n) selection per percentile instead of a full sort
+    auto percentile = [&](double q) {
+        size_t rank = static_cast<size_t>(std::ceil(q * tardiness.size()));
+        size_t index = rank > 0 ? rank - 1 : 0;
+        std::nth_element(tardiness.begin(), tardiness.begin() + index, tardiness.end());
+        return tardiness[index];
+    };
+    stats.tardiness_p50 = percentile(0.50);
+    stats.tardiness_p95 = percentile(0.95);
+    stats.tardiness_p99 = percentile(0.99);
+    return stats;
+}
+
+int PerformanceMetrics::get_total_io_time() const {
+    return timeline.io_time;
+}
+
+double PerformanceMetrics::calculate_io_overlap() const {
+    if (timeline.io_busy_time == 0) return 0.0;
+    return static_cast<double>(timeline.io_overlap_time) / timeline.io_busy_time * 100.0;
+}
+
+int PerformanceMetrics::get_overhead_time() const {
+    return timeline.overhead_time;
+}
+
+int PerformanceMetrics::calculate_context_switches() const {
+    // Counted from transitions between different PIDs in the Gantt chart
+    // (see GanttChart::summarize); idle time is not a context switch
+    return totals.context_switches;
 }
 
 void PerformanceMetrics::print_summary() const {
@@ -119,8 +356,19 @@ void PerformanceMetrics::print_summary() const {
     std::cout << "Average Waiting Time:    " << calculate_average_waiting_time() << " time units\n";
     std::cout << "Average Response Time:   " << calculate_average_response_time() << " time units\n";
     std::cout << "CPU Utilization:         " << calculate_cpu_utilization() << "%\n";
+    for (size_t cpu = 0; cpu < cpu_timelines.size(); cpu++) {
+        std::cout << "  CPU " << std::left << std::setw(19) << (std::to_string(cpu) + ":") << std::right
+                  << calculate_cpu_utilization(static_cast<int>(cpu)) << "%\n";
+    }
+    if (!cpu_timelines.empty()) {
+        std::cout << "Load Imbalance:          " << calculate_load_imbalance() << " (max/mean busy)\n";
+    }
     std::cout << "Throughput:              " << calculate_throughput() << " processes/time unit\n";
     std::cout << "Context Switches:        " << calculate_context_switches() << "\n";
+    if (get_overhead_time() > 0) {
+        std::cout << "Switch Overhead:         " << get_overhead_time() << " time units ("
+                  << 100.0 * get_overhead_time() / timeline.total_time << "% of total)\n";
+    }
     std::cout << "Fairness Index:          " << calculate_fairness_index() << "\n";
     std::cout << "\n";
 }
@@ -130,9 +378,12 @@ void PerformanceMetrics::print_detailed() const {
     print_process_metrics();
     
     std::cout << "=== Gantt Chart Analysis ===\n";
-    std::cout << "Total Time:      " << gantt.get_total_time() << " time units\n";
-    std::cout << "Total Idle Time: " << gantt.get_total_idle_time() << " time units\n";
-    std::cout << "Total Processes: " << processes.size() << "\n";
+    std::cout << "Total Time:      " << timeline.total_time << " time units\n";
+    std::cout << "Total Idle Time: " << timeline.idle_time << " time units\n";
+    if (!cpu_timelines.empty()) {
+        std::cout << "CPUs:            " << cpu_timelines.size() << "\n";
+    }
+    std::cout << "Total Processes: " << totals.total_processes << "\n";
     std::cout << "\n";
 }
 
@@ -141,7 +392,7 @@ void PerformanceMetrics::print_process_metrics() const {
     std::cout << "PID\tArrival\tBurst\tStart\tFinish\tTurnaround\tWaiting\tResponse\n";
     std::cout << "---\t-------\t-----\t-----\t------\t----------\t-------\t--------\n";
     
-    for (const auto& process : processes) {
+    for (const auto& process : *processes) {
         std::cout << process.pid << "\t"
                   << process.arrival_time << "\t"
                   << process.burst_time << "\t"
@@ -154,25 +405,56 @@ void PerformanceMetrics::print_process_metrics() const {
     std::cout << "\n";
 }
 
+void PerformanceMetrics::print_share_report(bool per_process) const {
+    std::vector<ShareRecord> shares = calculate_shares();
+    
+    std::cout << "=== Proportional Share ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+    if (per_process) {
+        std::cout << "PID\tTickets\tEntitled\tReceived\tRatio\n";
+        std::cout << "---\t-------\t--------\t--------\t-----\n";
+        for (const auto& record : shares) {
+            std::cout << record.pid << "\t"
+                      << record.tickets << "\t"
+                      << record.entitled << "\t\t"
+                      << record.received << "\t\t"
+                      << record.ratio() << "\n";
+        }
+    }
+    std::cout << "Share Error:     " << share_error(shares) << " (misallocated / total CPU time)\n\n";
+}
+
+void PerformanceMetrics::print_deadline_report() const {
+    DeadlineStats stats = calculate_deadline_stats();
+    
+    std::cout << "=== Deadlines ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Jobs with Deadline: " << stats.jobs << "\n";
+    std::cout << "Deadline Misses:    " << stats.missed << " (" << stats.miss_ratio * 100.0 << "%)\n";
+    std::cout << "Max Lateness:       " << stats.max_lateness << " time units\n";
+    std::cout << "Mean Tardiness:     " << stats.mean_tardiness << " time units\n";
+    std::cout << "Tardiness p50/p95/p99/max: " << stats.tardiness_p50 << " / " << stats.tardiness_p95
+              << " / " << stats.tardiness_p99 << " / " << stats.max_tardiness << "\n\n";
+}
+
+void PerformanceMetrics::print_io_report() const {
+    std::cout << "=== CPU / I/O Overlap ===\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "CPU Utilization:  " << calculate_cpu_utilization() << "%\n";
+    std::cout << "Total I/O Time:   " << timeline.io_time << " time units\n";
+    std::cout << "I/O Active Time:  " << timeline.io_busy_time << " time units\n";
+    std::cout << "CPU/I/O Overlap:  " << calculate_io_overlap() << "% of I/O-active time\n\n";
+}
+
 int PerformanceMetrics::get_total_time() const {
-    return gantt.get_total_time();
+    return totals.total_time;
 }
 
 int PerformanceMetrics::get_total_processes() const {
-    return processes.size();
+    return totals.total_processes;
 }
 
 bool PerformanceMetrics::is_valid_metrics() const {
-    for (const auto& process : processes) {
-        if (process.start_time < 0 || process.completion_time < 0) {
-            return false;
-        }
-        if (process.completion_time < process.start_time) {
-            return false;
-        }
-        if (process.start_time < process.arrival_time) {
-            return false;
-        }
-    }
-    return true;
+    // Every process needs start <= completion and arrival <= start
+    return totals.valid;
 }
@@ -0,0 +1,175 @@
+#include "scheduler.h"
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+
+/**
+ * Completely Fair Scheduler (CFS), after the Linux fair class
+ * - Process::priority is the nice value (-20..19, clamped) and maps to a
+ *   load weight through the kernel's nice-to-weight table.
+ * - Each job accumulates virtual runtime: real runtime scaled by
+ *   NICE_0_LOAD / weight, so heavier jobs age more slowly.
+ * - Runnable jobs sit in a red-black tree (std::set) ordered by vruntime;
+ *   the leftmost job runs next in O(log n).
+ * - A job's slice is its weighted share of the scheduling period, which is
+ *   `target_latency` or `min_granularity` per runnable job if that is
+ *   longer, and never shorter than `min_granularity`.
+ * - New jobs start at the queue's min_vruntime; a job back from I/O keeps
+ *   its vruntime but no less than min_vruntime minus half the target
+ *   latency. An arrival or wakeup preempts the running job when it is
+ *   behind by more than `min_granularity` of virtual time.
+ *
+ * vruntime is kept in 1/1024 time units so integer scaling stays precise.
+ */
+class CFSScheduler : public Scheduler {
+public:
+    static const int DEFAULT_TARGET_LATENCY = 20;
+    static const int DEFAULT_MIN_GRANULARITY = 2;
+    static const long long NICE_0_LOAD = 1024;
+
+    explicit CFSScheduler(int target_latency = DEFAULT_TARGET_LATENCY,
+                          int min_granularity = DEFAULT_MIN_GRANULARITY)
+        : Scheduler("Completely Fair Scheduler (CFS)"), target_latency(target_latency),
+          min_granularity(min_granularity), min_vruntime(0), queued_weight(0) {}
+
+    // Linux sched_prio_to_weight: each nice level is ~10% more or less CPU
+    static int nice_to_weight(int nice) {
+        static const int weights[40] = {
+            /* -20 */ 88761, 71755, 56483, 46273, 36291,
+            /* -15 */ 29154, 23254, 18705, 14949, 11916,
+            /* -10 */  9548,  7620,  6100,  4904,  3906,
+            /*  -5 */  3121,  2501,  1991,  1586,  1277,
+            /*   0 */  1024,   820,   655,   526,   423,
+            /*   5 */   335,   272,   215,   172,   137,
+            /*  10 */   110,    87,    70,    56,    45,
+            /*  15 */    36,    29,    23,    18,    15,
+        };
+        return weights[std::max(-20, std::min(19, nice)) + 20];
+    }
+
+    void schedule() override {
+        sort_by_arrival_time();
+
+        const size_t n = processes.size();
+        vruntime.assign(n, 0);
+        weight.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            weight[i] = nice_to_weight(processes[i].priority);
+        }
+        timeline.clear();
+        min_vruntime = 0;
+        queued_weight = 0;
+
+        ArrivalCursor arrivals;
+        arrivals.attach(processes, &io_wakeups);
+
+        while (!all_processes_complete()) {
+            admit(arrivals);
+
+            if (timeline.empty()) {
+                if (!arrivals.has_pending()) break;  // no more arrivals; done
+                advance_time(arrivals.next_arrival_time());
+                continue;
+            }
+
+            // Pick the leftmost job; the running job is not in the tree
+            const size_t slot = timeline.begin()->second;
+            dequeue(slot);
+            Process* current = &processes[slot];
+            const int slice_end = current_time + std::min(current->burst_left, slice_for(slot));
+
+            // Run the slice in pieces split at arrivals, which may preempt
+            while (true) {
+                int stop = slice_end;
+                if (arrivals.has_pending() && arrivals.next_arrival_time() < stop) {
+                    stop = arrivals.next_arrival_time();
+                }
+                if (stop > current_time) {
+                    const int ran = stop - current_time;
+                    run_process(current->pid, ran);
+                    vruntime[slot] += scaled(ran, weight[slot]);
+                    update_min_vruntime(slot);
+                }
+                if (!current->is_runnable() || current_time >= slice_end) break;
+                if (admit(arrivals, slot)) break;
+            }
+
+            if (current->is_runnable()) {
+                enqueue(slot);
+            }
+        }
+    }
+
+    int get_target_latency() const {
+        return target_latency;
+    }
+
+    int get_min_granularity() const {
+        return min_granularity;
+    }
+
+private:
+    int target_latency;
+    int min_granularity;
+    std::vector<long long> vruntime;  // Per slot, in 1/1024 time units
+    std::vector<int> weight;          // Per slot load weight
+    std::set<std::pair<long long, size_t> > timeline;  // (vruntime, slot), runnable only
+    long long min_vruntime;           // Monotonic floor for placing new jobs
+    long long queued_weight;          // Sum of weights in the timeline
+
+    // Real time -> virtual time for a job of weight `w`
+    static long long scaled(long long delta, int w) {
+        return delta * NICE_0_LOAD * 1024 / w;
+    }
+
+    void enqueue(size_t slot) {
+        timeline.insert(std::make_pair(vruntime[slot], slot));
+        queued_weight += weight[slot];
+    }
+
+    void dequeue(size_t slot) {
+        timeline.erase(std::make_pair(vruntime[slot], slot));
+        queued_weight -= weight[slot];
+    }
+
+    // Weighted share of the period, counting the running job
+    int slice_for(size_t slot) const {
+        const long long running = static_cast<long long>(timeline.size()) + 1;
+        const long long period = std::max<long long>(target_latency, running * min_granularity);
+        const long long total = queued_weight + weight[slot];
+        const long long slice = period * weight[slot] / total;
+        return static_cast<int>(std::max<long long>(slice, min_granularity));
+    }
+
+    void update_min_vruntime(size_t running) {
+        long long floor = vruntime[running];
+        if (!timeline.empty()) {
+            floor = std::min(floor, timeline.begin()->first);
+        }
+        min_vruntime = std::max(min_vruntime, floor);
+    }
+
+    // Enqueue arrivals and wakeups. Returns true if one of them should
+    // preempt the job in slot `running` (if any).
+    bool admit(ArrivalCursor& arrivals, size_t running = static_cast<size_t>(-1)) {
+        bool preempt = false;
+        while (Process* process = arrivals.pop_arrived(current_time)) {
+            if (process->is_complete()) continue;
+            const size_t slot = static_cast<size_t>(process - processes.data());
+            if (process->has_started) {
+                // Back from I/O: keep its vruntime, but a sleeper gets at most
+                // half a period of credit over the queue
+                vruntime[slot] = std::max(vruntime[slot], min_vruntime - scaled(target_latency / 2, NICE_0_LOAD));
+            } else {
+                vruntime[slot] = min_vruntime;
+            }
+            enqueue(slot);
+            if (running < processes.size() &&
+                vruntime[running] - vruntime[slot] > scaled(min_granularity, weight[slot])) {
+                preempt = true;
+            }
+        }
+        return preempt;
+    }
+};
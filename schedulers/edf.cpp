@@ -0,0 +1,54 @@
+#include "scheduler.h"
+#include <algorithm>
+#include <vector>
+
+/**
+ * Earliest Deadline First (EDF)
+ * - Runs the ready job with the earliest absolute deadline; jobs without a
+ *   deadline only run when no deadline job is ready.
+ * - Preemptive: an arrival with an earlier deadline takes the CPU.
+ * - Non-preemptive: the chosen job runs to completion.
+ *
+ * Event-driven like STCF: ready jobs sit in a ReadyQueue ordered by deadline
+ * (a min-heap), and decisions are made only at arrivals and completions, so
+ * the cost is O(log n) per event with no per-tick scans.
+ */
+class EDFScheduler : public Scheduler {
+public:
+    explicit EDFScheduler(bool preemptive = true)
+        : Scheduler(preemptive ? "Earliest Deadline First (EDF)" : "Non-preemptive EDF"),
+          preemptive(preemptive) {}
+
+    void schedule() override {
+        sort_by_arrival_time();
+
+        ReadyQueue ready(ReadyOrder::EARLIEST_DEADLINE);
+        ready.attach(processes, &io_wakeups);
+
+        while (!all_processes_complete()) {
+            ready.admit_arrivals(current_time);
+
+            if (ready.empty()) {
+                if (!ready.has_pending_arrivals()) break;  // no more arrivals; done
+                advance_time(ready.next_arrival_time());
+                continue;
+            }
+
+            Process* chosen = ready.pop();
+
+            // Preemptive: run until the next arrival, which may have an earlier deadline
+            int duration = chosen->burst_left;
+            if (preemptive && ready.has_pending_arrivals()) {
+                duration = std::min(duration, ready.next_arrival_time() - current_time);
+            }
+            run_process(chosen->pid, duration);
+
+            if (chosen->is_runnable()) {
+                ready.push(chosen);
+            }
+        }
+    }
+
+private:
+    bool preemptive;
+};
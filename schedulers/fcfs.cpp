@@ -23,19 +23,25 @@ public:
         
         sort_by_arrival_time();
 
-        // Iterate through all processes
-        for (auto& process : processes) {
+        // Processes are served strictly in arrival order
+        ReadyQueue ready(ReadyOrder::FIFO);
+        ready.attach(processes, &io_wakeups);
+
+        while (!all_processes_complete()) {
+            ready.admit_arrivals(current_time);
+
             // If CPU is idle (no process has arrived yet), advance time
-            if (current_time < process.arrival_time) {
-                advance_time(process.arrival_time);
+            if (ready.empty()) {
+                if (!ready.has_pending_arrivals()) break;
+                advance_time(ready.next_arrival_time());
+                continue;
             }
 
             // Run process for its entire burst time
-            run_process(process.pid, process.burst_time);
+            Process* process = ready.pop();
+            run_process(process->pid, process->burst_left);
         }
 
-        
-        
         std::cout << "FCFS scheduling completed.\n";
     }
 };
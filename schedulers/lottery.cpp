@@ -0,0 +1,93 @@
+#include "scheduler.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <cstdint>
+
+/**
+ * Lottery scheduling (proportional share, randomized)
+ * - Each job holds share_tickets(priority) tickets while it is runnable.
+ * - Every quantum a ticket is drawn uniformly at random; its holder runs for
+ *   up to one quantum, as in Round Robin.
+ * - The RNG is seeded, so a run is reproducible.
+ *
+ * Tickets live in a Fenwick (binary indexed) tree over process slots, so
+ * adding, removing and drawing a ticket are all O(log n).
+ */
+class LotteryScheduler : public Scheduler {
+public:
+    explicit LotteryScheduler(int tq = 2, uint64_t seed = 1)
+        : Scheduler("Lottery"), time_quantum(tq), seed(seed), total_tickets(0) {}
+
+    void schedule() override {
+        sort_by_arrival_time();
+
+        const size_t n = processes.size();
+        tree.assign(n + 1, 0);
+        total_tickets = 0;
+        rng.seed(seed);
+
+        ArrivalCursor arrivals;
+        arrivals.attach(processes, &io_wakeups);
+
+        while (!all_processes_complete()) {
+            admit(arrivals);
+
+            if (total_tickets == 0) {
+                if (!arrivals.has_pending()) break;  // no more arrivals; done
+                advance_time(arrivals.next_arrival_time());
+                continue;
+            }
+
+            std::uniform_int_distribution<long long> draw(0, total_tickets - 1);
+            const size_t slot = find_ticket(draw(rng));
+            Process* winner = &processes[slot];
+            run_process(winner->pid, std::min(time_quantum, winner->burst_left));
+
+            if (!winner->is_runnable()) {
+                // Finished or blocked on I/O; a wakeup brings the tickets back
+                add_tickets(slot, -share_tickets(winner->priority));
+            }
+        }
+    }
+
+    int get_time_quantum() const {
+        return time_quantum;
+    }
+
+private:
+    int time_quantum;
+    uint64_t seed;
+    std::mt19937_64 rng;
+    std::vector<long long> tree;  // Fenwick tree of tickets, 1-based over slots
+    long long total_tickets;
+
+    void admit(ArrivalCursor& arrivals) {
+        while (Process* process = arrivals.pop_arrived(current_time)) {
+            if (!process->is_complete()) {
+                add_tickets(static_cast<size_t>(process - processes.data()), share_tickets(process->priority));
+            }
+        }
+    }
+
+    void add_tickets(size_t slot, long long delta) {
+        total_tickets += delta;
+        for (size_t i = slot + 1; i < tree.size(); i += i & (~i + 1)) {
+            tree[i] += delta;
+        }
+    }
+
+    // Slot holding ticket number `ticket` (0-based) in slot order
+    size_t find_ticket(long long ticket) const {
+        size_t pos = 0;
+        size_t step = 1;
+        while (step * 2 < tree.size()) step *= 2;
+        for (; step > 0; step /= 2) {
+            if (pos + step < tree.size() && tree[pos + step] <= ticket) {
+                pos += step;
+                ticket -= tree[pos];
+            }
+        }
+        return pos;  // 1-based position pos + 1 is slot pos
+    }
+};
@@ -0,0 +1,181 @@
+#include "scheduler.h"
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+
+/**
+ * Multi-Level Feedback Queue (MLFQ)
+ * - Level 0 is the highest priority; each level is a FIFO with its own quantum.
+ * - New jobs enter level 0. A job that uses up its level's quantum (summed
+ *   over slices, so yielding early does not reset it) moves down one level;
+ *   the lowest level is plain Round Robin.
+ * - An arrival preempts a job running below level 0. The preempted job
+ *   keeps its level and what is left of its allotment.
+ * - A job that blocks on I/O keeps its level and allotment, so jobs that
+ *   yield the CPU before their quantum runs out stay near the top.
+ * - Every `boost_period` time units all jobs move back to level 0 with a
+ *   fresh allotment (0 disables the boost).
+ *
+ * Dispatch is O(1): a 64-bit mask has bit L set while level L is non-empty,
+ * and the lowest set bit is the level to serve. Levels are intrusive FIFO
+ * lists over process slots, so a boost splices them onto level 0 in
+ * O(levels); allotments are reset lazily when a boosted job is next picked.
+ */
+class MLFQScheduler : public Scheduler {
+public:
+    static const int MAX_LEVELS = 64;
+    static const int DEFAULT_BOOST_PERIOD = 100;
+
+    // Quanta for levels 0, 1, 2, ... (the number of entries is the number of levels)
+    explicit MLFQScheduler(const std::vector<int>& quanta = std::vector<int>{2, 4, 8},
+                           int boost_period = DEFAULT_BOOST_PERIOD)
+        : Scheduler("Multi-Level Feedback Queue (MLFQ)"), quanta(quanta),
+          boost_period(boost_period), nonempty(0) {}
+
+    void schedule() override {
+        sort_by_arrival_time();
+
+        const size_t n = processes.size();
+        const int levels = static_cast<int>(quanta.size());
+        level.assign(n, 0);
+        used.assign(n, 0);
+        epoch.assign(n, 0);
+        next.assign(n, NONE);
+        head.assign(levels, NONE);
+        tail.assign(levels, NONE);
+        nonempty = 0;
+        boosts = 0;
+
+        ArrivalCursor arrivals;
+        arrivals.attach(processes, &io_wakeups);
+        int next_boost = boost_period > 0 ? current_time + boost_period : -1;
+
+        while (!all_processes_complete()) {
+            admit(arrivals);
+            if (next_boost >= 0 && current_time >= next_boost) {
+                boost();
+                while (next_boost <= current_time) next_boost += boost_period;
+            }
+
+            if (nonempty == 0) {
+                if (!arrivals.has_pending()) break;  // no more arrivals; done
+                advance_time(arrivals.next_arrival_time());
+                continue;
+            }
+
+            const int current = lowest_set_bit(nonempty);
+            const size_t slot = pop_front(current);
+            Process* chosen = &processes[slot];
+            if (epoch[slot] != boosts) {
+                // Boosted while waiting: the allotment starts over at level 0
+                epoch[slot] = boosts;
+                used[slot] = 0;
+            }
+            level[slot] = current;
+
+            // Run out the allotment unless an arrival or a boost comes first
+            int slice = std::min(chosen->burst_left, quanta[current] - used[slot]);
+            if (current > 0 && arrivals.has_pending()) {
+                slice = std::min(slice, arrivals.next_arrival_time() - current_time);
+            }
+            if (next_boost >= 0) {
+                slice = std::min(slice, next_boost - current_time);
+            }
+            run_process(chosen->pid, slice);
+            used[slot] += slice;
+
+            if (chosen->is_complete()) continue;
+            if (used[slot] >= quanta[current]) {
+                level[slot] = std::min(current + 1, levels - 1);
+                used[slot] = 0;
+            }
+
+            // As in RR, jobs that arrived during the slice queue ahead of it
+            admit(arrivals);
+            if (chosen->is_runnable()) {
+                push_back(slot);
+            }
+        }
+    }
+
+    const std::vector<int>& get_quanta() const {
+        return quanta;
+    }
+
+    int get_boost_period() const {
+        return boost_period;
+    }
+
+private:
+    enum : size_t { NONE = static_cast<size_t>(-1) };  // End of a level list
+
+    std::vector<int> quanta;
+    int boost_period;
+    std::vector<int> level;         // Level of a slot's last run (where it requeues)
+    std::vector<int> used;          // Time used of the current level's allotment
+    std::vector<uint32_t> epoch;    // Boost count when `used` was last valid
+    std::vector<size_t> next;       // Next slot in the same level list
+    std::vector<size_t> head;       // First slot per level (NONE = empty)
+    std::vector<size_t> tail;       // Last slot per level
+    uint64_t nonempty;              // Bit L set while level L is non-empty
+    uint32_t boosts;
+
+    static int lowest_set_bit(uint64_t mask) {
+        return __builtin_ctzll(mask);
+    }
+
+    void push_back(size_t slot) {
+        const int target = level[slot];
+        next[slot] = NONE;
+        if (head[target] == NONE) {
+            head[target] = slot;
+        } else {
+            next[tail[target]] = slot;
+        }
+        tail[target] = slot;
+        nonempty |= uint64_t(1) << target;
+    }
+
+    size_t pop_front(int current) {
+        const size_t slot = head[current];
+        head[current] = next[slot];
+        if (head[current] == NONE) {
+            tail[current] = NONE;
+            nonempty &= ~(uint64_t(1) << current);
+        }
+        return slot;
+    }
+
+    void admit(ArrivalCursor& arrivals) {
+        while (Process* process = arrivals.pop_arrived(current_time)) {
+            if (process->is_complete()) continue;
+            const size_t slot = static_cast<size_t>(process - processes.data());
+            if (!process->has_started) {
+                level[slot] = 0;
+                epoch[slot] = boosts;
+            } else if (epoch[slot] != boosts) {
+                level[slot] = 0;  // Boosted while blocked on I/O
+            }
+            push_back(slot);
+        }
+    }
+
+    // Splice every lower level onto the end of level 0, keeping level order
+    void boost() {
+        boosts++;
+        uint64_t lower = nonempty & ~uint64_t(1);
+        while (lower != 0) {
+            const int current = lowest_set_bit(lower);
+            lower &= lower - 1;
+            if (head[0] == NONE) {
+                head[0] = head[current];
+            } else {
+                next[tail[0]] = head[current];
+            }
+            tail[0] = tail[current];
+            head[current] = NONE;
+            tail[current] = NONE;
+        }
+        if (nonempty != 0) nonempty = 1;
+    }
+};
@@ -0,0 +1,187 @@
+#include "scheduler.h"
+#include "indexed_heap.h"
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <vector>
+#include <cstdint>
+
+/**
+ * Priority scheduling (lower priority number = higher priority)
+ * - Non-preemptive: the best ready job runs to completion.
+ * - Preemptive: a ready job with a better effective priority takes the CPU.
+ *
+ * Aging prevents starvation: every `aging_interval` time units a waiting
+ * job's effective priority improves by one, down to min(base, 0). It is
+ * reset to the base priority when the job is dispatched. Ties go to the
+ * earlier arrival, then the lower PID.
+ *
+ * Ready jobs live in an IndexedHeap keyed by effective priority, so an aging
+ * step is an O(log n) update of one entry. Aging steps are driven by a
+ * min-heap of (time, slot) events instead of rescanning the ready set, so
+ * only jobs whose priority actually changes cost anything.
+ */
+class PriorityScheduler : public Scheduler {
+public:
+    static const int DEFAULT_AGING_INTERVAL = 10;
+
+    explicit PriorityScheduler(bool preemptive, int aging_interval = DEFAULT_AGING_INTERVAL)
+        : Scheduler(preemptive ? "Preemptive Priority" : "Priority (Non-preemptive)"),
+          preemptive(preemptive), aging_interval(aging_interval),
+          ready(ReadyLess(this)) {}
+
+    void schedule() override {
+        sort_by_arrival_time();
+
+        const size_t n = processes.size();
+        effective.resize(n);
+        ready_since.assign(n, 0);
+        generation.assign(n, 0);
+        for (size_t i = 0; i < n; i++) {
+            effective[i] = processes[i].priority;
+        }
+        ready.reset(n);
+        aging_events = AgingQueue();
+
+        ArrivalCursor arrivals;
+        arrivals.attach(processes, &io_wakeups);
+
+        while (!all_processes_complete()) {
+            while (Process* process = arrivals.pop_arrived(current_time)) {
+                if (!process->is_complete()) {
+                    // Admission can lag the arrival (or I/O wakeup); the wait
+                    // counts from when the job became ready
+                    make_ready(slot_of(process), process->ready_time);
+                }
+            }
+            apply_aging();
+
+            if (ready.empty()) {
+                if (!arrivals.has_pending()) break;  // no more arrivals; done
+                advance_time(arrivals.next_arrival_time());
+                continue;
+            }
+
+            size_t slot = ready.pop();
+            Process* chosen = &processes[slot];
+            effective[slot] = chosen->priority;  // Aging credit is spent on dispatch
+
+            // Preemptive: run until the next event that could change the choice
+            int duration = chosen->burst_left;
+            if (preemptive) {
+                if (arrivals.has_pending()) {
+                    duration = std::min(duration, arrivals.next_arrival_time() - current_time);
+                }
+                int next_aging = next_aging_time();
+                if (next_aging >= 0) {
+                    duration = std::min(duration, next_aging - current_time);
+                }
+            }
+            run_process(chosen->pid, duration);
+
+            if (chosen->is_runnable()) {
+                make_ready(slot, current_time);
+            }
+        }
+    }
+
+    // Time units of waiting per priority step (0 disables aging)
+    void set_aging_interval(int interval) {
+        if (interval >= 0) aging_interval = interval;
+    }
+
+    int get_aging_interval() const {
+        return aging_interval;
+    }
+
+private:
+    // Heap order: effective priority, then arrival time, then PID
+    struct ReadyLess {
+        const PriorityScheduler* owner;
+
+        explicit ReadyLess(const PriorityScheduler* owner) : owner(owner) {}
+
+        bool operator()(size_t a, size_t b) const {
+            if (owner->effective[a] != owner->effective[b]) {
+                return owner->effective[a] < owner->effective[b];
+            }
+            const Process& pa = owner->processes[a];
+            const Process& pb = owner->processes[b];
+            if (pa.arrival_time != pb.arrival_time) return pa.arrival_time < pb.arrival_time;
+            return pa.pid < pb.pid;
+        }
+    };
+
+    // Pending aging step: (time, slot, generation of the wait it belongs to)
+    struct AgingEvent {
+        int time;
+        size_t slot;
+        uint32_t generation;
+
+        bool operator>(const AgingEvent& other) const { return time > other.time; }
+    };
+    typedef std::priority_queue<AgingEvent, std::vector<AgingEvent>, std::greater<AgingEvent> > AgingQueue;
+
+    bool preemptive;
+    int aging_interval;
+    std::vector<int> effective;       // Effective priority per slot
+    std::vector<int> ready_since;     // Start of the current wait per slot
+    std::vector<uint32_t> generation; // Bumped on every enqueue; older events are stale
+    IndexedHeap<ReadyLess> ready;
+    AgingQueue aging_events;
+
+    size_t slot_of(const Process* process) const {
+        return static_cast<size_t>(process - processes.data());
+    }
+
+    static int aging_floor(int base) {
+        return std::min(base, 0);
+    }
+
+    void make_ready(size_t slot, int since) {
+        generation[slot]++;
+        ready_since[slot] = since;
+        effective[slot] = processes[slot].priority;
+        ready.push(slot);
+
+        if (aging_interval > 0 && effective[slot] > aging_floor(effective[slot])) {
+            AgingEvent event = {since + aging_interval, slot, generation[slot]};
+            aging_events.push(event);
+        }
+    }
+
+    bool is_stale(const AgingEvent& event) const {
+        return event.generation != generation[event.slot] || !ready.contains(event.slot);
+    }
+
+    // Apply every aging step due by current_time
+    void apply_aging() {
+        while (!aging_events.empty() && aging_events.top().time <= current_time) {
+            AgingEvent event = aging_events.top();
+            aging_events.pop();
+            if (is_stale(event)) continue;
+
+            const size_t slot = event.slot;
+            const int base = processes[slot].priority;
+            const int steps = (current_time - ready_since[slot]) / aging_interval;
+            const int aged = std::max(aging_floor(base), base - steps);
+            if (aged != effective[slot]) {
+                effective[slot] = aged;
+                ready.update(slot);
+            }
+
+            if (aged > aging_floor(base)) {
+                AgingEvent next = {ready_since[slot] + (steps + 1) * aging_interval, slot, event.generation};
+                aging_events.push(next);
+            }
+        }
+    }
+
+    // Time of the next live aging step, or -1
+    int next_aging_time() {
+        while (!aging_events.empty() && is_stale(aging_events.top())) {
+            aging_events.pop();
+        }
+        return aging_events.empty() ? -1 : aging_events.top().time;
+    }
+};
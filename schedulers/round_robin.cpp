@@ -1,5 +1,4 @@
 #include "scheduler.h"
-#include <queue>
 #include <algorithm>
 #include <vector>
 
@@ -19,31 +18,23 @@ public:
 
         sort_by_arrival_time();
 
-        // Queue holds PIDs (not indices). We'll enqueue as processes arrive.
-        std::queue<int> ready_q;
-
-        int next_to_arrive = 0; // index into `processes` (sorted by arrival)
-
-        auto enqueue_arrivals_up_to = [&](int t) {
-            while (next_to_arrive < n && processes[next_to_arrive].arrival_time <= t) {
-                ready_q.push(processes[next_to_arrive].pid);
-                next_to_arrive++;
-            }
-        };
+        // FIFO ready queue fed from the arrival-sorted process list
+        ReadyQueue ready_q(ReadyOrder::FIFO);
+        ready_q.attach(processes, &io_wakeups);
 
         // If simulation starts before the first arrival, jump to the first arrival.
-        if (next_to_arrive < n && current_time < processes[0].arrival_time) {
-            advance_time(processes[0].arrival_time);
+        if (current_time < ready_q.next_arrival_time()) {
+            advance_time(ready_q.next_arrival_time());
         }
-        enqueue_arrivals_up_to(current_time);
+        ready_q.admit_arrivals(current_time);
 
         // Main RR loop
         while (!all_processes_complete()) {
             // If nothing is ready, jump to the next arrival time.
             if (ready_q.empty()) {
-                if (next_to_arrive < n) {
-                    advance_time(processes[next_to_arrive].arrival_time);
-                    enqueue_arrivals_up_to(current_time);
+                if (ready_q.has_pending_arrivals()) {
+                    advance_time(ready_q.next_arrival_time());
+                    ready_q.admit_arrivals(current_time);
                     continue;
                 } else {
                     // No one left to arrive and queue empty => done
@@ -51,31 +42,28 @@ public:
                 }
             }
 
-            // Pick next PID in round-robin order
-            int pid = ready_q.front();
-            ready_q.pop();
-
-            Process* p = find_process_by_pid(pid);
-            if (!p || p->is_complete()) {
-                // Skip invalid or already finished (defensive)
-                enqueue_arrivals_up_to(current_time);
+            // Pick next process in round-robin order
+            Process* p = ready_q.pop();
+            if (p->is_complete()) {
+                // Skip already finished (defensive)
+                ready_q.admit_arrivals(current_time);
                 continue;
             }
 
             // Time slice for this round
-            int slice = std::min(time_quantum, p->remaining_time);
+            int slice = std::min(time_quantum, p->burst_left);
 
             // Run the process for `slice` time units.
             // This helper sets start_time on first dispatch, updates response_time,
             // adds to Gantt, and handles completion bookkeeping.
-            run_process(pid, slice);
+            run_process(p->pid, slice);
 
-            // Enqueue any processes that arrived while we were running `pid`.
-            enqueue_arrivals_up_to(current_time);
+            // Enqueue any processes that arrived while we were running `p`.
+            ready_q.admit_arrivals(current_time);
 
-            // If `pid` still has remaining time, rotate it to the back of the queue.
-            if (!p->is_complete()) {
-                ready_q.push(pid);
+            // If `p` still has remaining time, rotate it to the back of the queue.
+            if (p->is_runnable()) {
+                ready_q.push(p);
             }
         }
     }
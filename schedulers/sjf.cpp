@@ -5,9 +5,9 @@
 /**
  * Shortest Job First (SJF) - Non-preemptive
  * Follows the assignment guidelines:
- *  - Use get_ready_processes(current_time) to obtain arrived, incomplete processes
+ *  - Keep arrived, incomplete processes in a ReadyQueue ordered by burst time
  *  - If none are ready, advance_time(next_arrival)
- *  - Always pick the ready process with the smallest burst (remaining) time
+ *  - Always pick the ready process with the smallest burst time (tie by PID)
  *  - Run the chosen process to completion with run_process(pid, duration)
  */
 class SJFScheduler : public Scheduler {
@@ -18,42 +18,29 @@ public:
         // Ensure deterministic start state
         sort_by_arrival_time();
 
+        ReadyQueue ready(ReadyOrder::SHORTEST_BURST);
+        ready.attach(processes, &io_wakeups);
+
         while (!all_processes_complete()) {
-            // Get all arrived & incomplete processes at current_time
-            std::vector<Process*> ready = get_ready_processes(current_time);
+            // Admit all processes that have arrived by current_time
+            ready.admit_arrivals(current_time);
 
             if (ready.empty()) {
                 // No ready processes: jump to the next arrival
-                int next_arrival = -1;
-                for (const auto& p : processes) {
-                    if (!p.is_complete() && p.arrival_time > current_time) {
-                        if (next_arrival == -1 || p.arrival_time < next_arrival) {
-                            next_arrival = p.arrival_time;
-                        }
-                    }
-                }
-                if (next_arrival == -1) {
+                if (!ready.has_pending_arrivals()) {
                     // Nothing left to arrive; we're done
                     break;
                 }
                 // Advance time using the provided helper (adds idle slot to Gantt)
-                advance_time(next_arrival);
+                advance_time(ready.next_arrival_time());
                 continue;
             }
 
-            // Choose the shortest job among ready processes (by remaining_time, tie by PID)
-            Process* chosen = *std::min_element(
-                ready.begin(), ready.end(),
-                [](const Process* a, const Process* b) {
-                    if (a->remaining_time != b->remaining_time) {
-                        return a->remaining_time < b->remaining_time;
-                    }
-                    return a->pid < b->pid;
-                }
-            );
+            // Choose the shortest job among ready processes
+            Process* chosen = ready.pop();
 
             // Non-preemptive: run to completion
-            const int duration = chosen->remaining_time;
+            const int duration = chosen->burst_left;
             run_process(chosen->pid, duration);
         }
     }
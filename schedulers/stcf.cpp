@@ -7,6 +7,12 @@
  * Preemptive SJF: always run the ready process with the smallest remaining time.
  * - Uses helper functions so metrics (response/start/finish) are recorded correctly.
  * - No iostream output here; reporting is handled by the framework.
+ *
+ * Event-driven: the ready set lives in a ReadyQueue ordered by remaining time
+ * (a min-heap), and a scheduling decision is only made when something can
+ * change it - a new arrival or the completion of the running job. Between two
+ * events the running job stays the minimum, so it runs in a single slice
+ * instead of tick by tick.
  */
 class STCFScheduler : public Scheduler {
 public:
@@ -15,38 +21,33 @@ public:
     void schedule() override {
         sort_by_arrival_time();
 
+        ReadyQueue ready(ReadyOrder::SHORTEST_REMAINING);
+        ready.attach(processes, &io_wakeups);
+
         while (!all_processes_complete()) {
-            // Fetch all arrived & not-yet-finished processes at current_time
-            std::vector<Process*> ready = get_ready_processes(current_time);
+            // Admit everything that has arrived by now
+            ready.admit_arrivals(current_time);
 
             if (ready.empty()) {
                 // Nothing ready: jump to the next arrival time
-                int next_arrival = -1;
-                for (const auto& p : processes) {
-                    if (!p.is_complete() && p.arrival_time > current_time) {
-                        if (next_arrival == -1 || p.arrival_time < next_arrival) {
-                            next_arrival = p.arrival_time;
-                        }
-                    }
-                }
-                if (next_arrival == -1) break;  // no more arrivals; done
-                advance_time(next_arrival);
+                if (!ready.has_pending_arrivals()) break;  // no more arrivals; done
+                advance_time(ready.next_arrival_time());
                 continue;
             }
 
-            // Pick the process with the smallest remaining time (tie-break by PID for stability)
-            Process* chosen = *std::min_element(
-                ready.begin(), ready.end(),
-                [](const Process* a, const Process* b) {
-                    if (a->remaining_time != b->remaining_time) {
-                        return a->remaining_time < b->remaining_time;
-                    }
-                    return a->pid < b->pid;
-                }
-            );
-
-            // Preemptive step: run only 1 time unit to allow switching if a shorter job arrives
-            run_process(chosen->pid, 1);
+            // Smallest remaining time (tie-break by PID for stability)
+            Process* chosen = ready.pop();
+
+            // Run until the job completes or the next arrival may preempt it
+            int duration = chosen->burst_left;
+            if (ready.has_pending_arrivals()) {
+                duration = std::min(duration, ready.next_arrival_time() - current_time);
+            }
+            run_process(chosen->pid, duration);
+
+            if (chosen->is_runnable()) {
+                ready.push(chosen);
+            }
         }
     }
 };
@@ -0,0 +1,93 @@
+#include "scheduler.h"
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+/**
+ * Stride scheduling (proportional share, deterministic)
+ * - Each job's stride is STRIDE1 / share_tickets(priority); its pass value
+ *   grows by one stride per quantum it runs, and by the matching fraction
+ *   of a stride when it blocks before the quantum is up (Waldspurger), so
+ *   short CPU bursts keep their share.
+ * - The job with the lowest pass runs next for up to one quantum (ties go
+ *   to the earlier arrival).
+ * - A new job starts one stride past the pass of the last job dispatched,
+ *   as if it had just run, so it neither catches up on time it was absent
+ *   nor jumps ahead of the jobs already waiting. A job back from I/O keeps
+ *   its pass unless that fell behind, so blocking earns no credit.
+ *
+ * Runnable jobs sit in a min-heap of (pass, slot): O(log n) per decision.
+ */
+class StrideScheduler : public Scheduler {
+public:
+    static const long long STRIDE1 = 1 << 20;
+
+    explicit StrideScheduler(int tq = 2)
+        : Scheduler("Stride"), time_quantum(tq) {}
+
+    void schedule() override {
+        sort_by_arrival_time();
+
+        pass.assign(processes.size(), 0);
+        ready = PassQueue();
+        global_pass = 0;
+
+        ArrivalCursor arrivals;
+        arrivals.attach(processes, &io_wakeups);
+
+        while (!all_processes_complete()) {
+            admit(arrivals);
+
+            if (ready.empty()) {
+                if (!arrivals.has_pending()) break;  // no more arrivals; done
+                advance_time(arrivals.next_arrival_time());
+                continue;
+            }
+
+            const size_t slot = ready.top().second;
+            ready.pop();
+            Process* chosen = &processes[slot];
+            global_pass = pass[slot];
+            const int before = chosen->remaining_time;
+            run_process(chosen->pid, std::min(time_quantum, chosen->burst_left));
+
+            if (!chosen->is_complete()) {
+                const int ran = before - chosen->remaining_time;
+                pass[slot] += STRIDE1 / share_tickets(chosen->priority) * ran / time_quantum;
+            }
+            if (chosen->is_runnable()) {
+                ready.push(std::make_pair(pass[slot], slot));
+            }
+        }
+    }
+
+    int get_time_quantum() const {
+        return time_quantum;
+    }
+
+private:
+    typedef std::priority_queue<std::pair<long long, size_t>, std::vector<std::pair<long long, size_t> >,
+                                std::greater<std::pair<long long, size_t> > > PassQueue;
+
+    int time_quantum;
+    std::vector<long long> pass;  // Per slot
+    PassQueue ready;              // (pass, slot) of runnable jobs
+    long long global_pass;        // Pass of the last job dispatched
+
+    void admit(ArrivalCursor& arrivals) {
+        while (Process* process = arrivals.pop_arrived(current_time)) {
+            if (!process->is_complete()) {
+                const size_t slot = static_cast<size_t>(process - processes.data());
+                if (process->has_started) {
+                    // Back from I/O: no credit for the time away
+                    pass[slot] = std::max(pass[slot], global_pass);
+                } else {
+                    pass[slot] = global_pass + STRIDE1 / share_tickets(process->priority);
+                }
+                ready.push(std::make_pair(pass[slot], slot));
+            }
+        }
+    }
+};
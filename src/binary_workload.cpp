@@ -0,0 +1,209 @@
+#include "binary_workload.h"
+#include "file_parser.h"
+#include "mapped_file.h"
+#include <fstream>
+#include <stdexcept>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+
+namespace {
+
+const char MAGIC[8] = {'S', 'C', 'H', 'E', 'D', 'W', 'K', 'L'};
+const size_t HEADER_SIZE = 32;
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t count;
+    uint64_t name_bytes;
+};
+static_assert(sizeof(Header) == HEADER_SIZE, "binary workload header must be 32 bytes");
+
+bool host_is_little_endian() {
+    const uint16_t probe = 1;
+    return *reinterpret_cast<const uint8_t*>(&probe) == 1;
+}
+
+// Byte-swap 4- or 8-byte values in place (big-endian hosts only)
+template <typename T>
+void swap_bytes(T* values, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint8_t* b = reinterpret_cast<uint8_t*>(&values[i]);
+        for (size_t lo = 0, hi = sizeof(T) - 1; lo < hi; lo++, hi--) {
+            std::swap(b[lo], b[hi]);
+        }
+    }
+}
+
+template <typename T>
+void write_column(std::ofstream& out, const std::vector<T>& column) {
+    if (host_is_little_endian()) {
+        out.write(reinterpret_cast<const char*>(column.data()), column.size() * sizeof(T));
+        return;
+    }
+    std::vector<T> swapped(column);
+    swap_bytes(swapped.data(), swapped.size());
+    out.write(reinterpret_cast<const char*>(swapped.data()), swapped.size() * sizeof(T));
+}
+
+template <typename T>
+void read_column(const char*& cursor, std::vector<T>& column, size_t count) {
+    column.resize(count);
+    std::memcpy(column.data(), cursor, count * sizeof(T));
+    if (!host_is_little_endian()) swap_bytes(column.data(), count);
+    cursor += count * sizeof(T);
+}
+
+} // namespace
+
+bool BinaryWorkload::is_binary_file(const std::string& filename) {
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    char magic[sizeof(MAGIC)];
+    return file.read(magic, sizeof(magic)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+void BinaryWorkload::save(const std::string& filename, const ProcessTable& table) {
+    const size_t count = table.size();
+    for (size_t i = 0; i < count; i++) {
+        if (table.bursts_id[i] != 0) {
+            throw std::runtime_error("I/O burst sequences cannot be stored in a binary workload: " + filename);
+        }
+    }
+    
+    // Name blob: names concatenated in slot order, delimited by offsets
+    std::vector<uint32_t> offsets(count + 1, 0);
+    std::string names;
+    for (size_t i = 0; i < count; i++) {
+        if (table.name_id[i] != 0) {
+            names += NameTable::lookup(table.name_id[i]);
+        }
+        if (names.size() > UINT32_MAX) {
+            throw std::runtime_error("Name data too large for binary workload: " + filename);
+        }
+        offsets[i + 1] = static_cast<uint32_t>(names.size());
+    }
+    
+    std::ofstream out(filename.c_str(), std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        throw std::runtime_error("Cannot open file: " + filename);
+    }
+    
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.header_size = HEADER_SIZE;
+    header.count = count;
+    header.name_bytes = names.size();
+    if (!host_is_little_endian()) {
+        swap_bytes(&header.version, 2);
+        swap_bytes(&header.count, 2);
+    }
+    out.write(reinterpret_cast<const char*>(&header), HEADER_SIZE);
+    
+    write_column(out, table.pid);
+    write_column(out, table.arrival_time);
+    write_column(out, table.burst_time);
+    write_column(out, table.priority);
+    write_column(out, table.deadline);
+    write_column(out, table.period);
+    write_column(out, offsets);
+    out.write(names.data(), names.size());
+    
+    if (!out) {
+        throw std::runtime_error("Error writing binary workload: " + filename);
+    }
+}
+
+void BinaryWorkload::save(const std::string& filename, const std::vector<Process>& processes) {
+    save(filename, ProcessTable(processes));
+}
+
+ProcessTable BinaryWorkload::load_table(const std::string& filename) {
+    MappedFile file(filename);
+    
+    Header header;
+    if (file.size() < HEADER_SIZE) {
+        throw std::runtime_error("Not a binary workload file: " + filename);
+    }
+    std::memcpy(&header, file.data(), HEADER_SIZE);
+    if (!host_is_little_endian()) {
+        swap_bytes(&header.version, 2);
+        swap_bytes(&header.count, 2);
+    }
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not a binary workload file: " + filename);
+    }
+    if (header.version < 1 || header.version > VERSION || header.header_size < HEADER_SIZE) {
+        throw std::runtime_error("Unsupported binary workload version " +
+                                 std::to_string(header.version) + ": " + filename);
+    }
+    
+    const uint64_t count = header.count;
+    const uint64_t int_columns = header.version >= 2 ? 6 : 4;
+    const uint64_t expected = header.header_size + count * int_columns * sizeof(int32_t) +
+                              (count + 1) * sizeof(uint32_t) + header.name_bytes;
+    if (count > file.size() || expected != file.size()) {
+        throw std::runtime_error("Truncated or corrupt binary workload: " + filename);
+    }
+    
+    ProcessTable table;
+    const char* cursor = file.data() + header.header_size;
+    read_column(cursor, table.pid, count);
+    read_column(cursor, table.arrival_time, count);
+    read_column(cursor, table.burst_time, count);
+    read_column(cursor, table.priority, count);
+    if (header.version >= 2) {
+        read_column(cursor, table.deadline, count);
+        read_column(cursor, table.period, count);
+    } else {
+        table.deadline.assign(count, -1);
+        table.period.assign(count, 0);
+    }
+    
+    // Same limits as the text parser
+    for (size_t i = 0; i < count; i++) {
+        if (table.pid[i] < 0 || table.arrival_time[i] < 0 || table.burst_time[i] <= 0 ||
+            table.period[i] < 0 ||
+            (table.deadline[i] != -1 && table.deadline[i] <= table.arrival_time[i])) {
+            throw std::runtime_error("Truncated or corrupt binary workload: " + filename);
+        }
+    }
+    table.remaining_time = table.burst_time;
+    table.bursts_id.assign(count, 0);
+    
+    std::vector<uint32_t> offsets;
+    read_column(cursor, offsets, count + 1);
+    const char* names = cursor;
+    
+    // Intern names, resolving repeats locally
+    table.name_id.assign(count, 0);
+    std::unordered_map<std::string, uint32_t> seen;
+    std::string name;
+    for (size_t i = 0; i < count; i++) {
+        if (offsets[i + 1] == offsets[i]) continue;
+        if (offsets[i + 1] < offsets[i] || offsets[i + 1] > header.name_bytes) {
+            throw std::runtime_error("Corrupt name table in binary workload: " + filename);
+        }
+        name.assign(names + offsets[i], names + offsets[i + 1]);
+        auto it = seen.find(name);
+        if (it == seen.end()) {
+            it = seen.insert(std::make_pair(name, NameTable::intern(name))).first;
+        }
+        table.name_id[i] = it->second;
+    }
+    
+    return table;
+}
+
+std::vector<Process> BinaryWorkload::load(const std::string& filename) {
+    return load_table(filename).to_processes();
+}
+
+size_t BinaryWorkload::convert_text(const std::string& text_file, const std::string& binary_file,
+                                    unsigned threads) {
+    std::vector<Process> processes = FileParser::parse_file_parallel(text_file, threads);
+    save(binary_file, processes);
+    return processes.size();
+}
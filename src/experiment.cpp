@@ -0,0 +1,217 @@
+#include "experiment.h"
+#include "gantt_sink.h"
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+
+double QuantumRun::objective_value(SweepObjective objective) const {
+    switch (objective) {
+        case SweepObjective::WAITING:          return metrics.average_waiting_time;
+        case SweepObjective::RESPONSE:         return metrics.average_response_time;
+        case SweepObjective::TURNAROUND:       return metrics.average_turnaround_time;
+        case SweepObjective::CONTEXT_SWITCHES: return static_cast<double>(metrics.context_switches);
+    }
+    return 0.0;
+}
+
+std::vector<AlgorithmRun> ExperimentRunner::compare_algorithms(const std::vector<Process>& processes,
+                                                               const std::vector<std::string>& algorithms,
+                                                               const SwitchCost& cost) {
+    std::vector<AlgorithmRun> runs(algorithms.size());
+    std::vector<std::thread> workers;
+    
+    for (size_t i = 0; i < algorithms.size(); i++) {
+        workers.push_back(std::thread([&runs, &processes, &algorithms, &cost, i]() {
+            runs[i] = run_algorithm(processes, algorithms[i], cost);
+        }));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    
+    return runs;
+}
+
+AlgorithmRun ExperimentRunner::run_algorithm(const std::vector<Process>& processes,
+                                             const std::string& algorithm, const SwitchCost& cost) {
+    AlgorithmRun run;
+    run.algorithm = algorithm;
+    
+    try {
+        std::unique_ptr<Scheduler> scheduler(create_scheduler(algorithm));
+        run.name = scheduler->get_algorithm_name();
+        scheduler->set_switch_cost(cost);
+        run.seconds = run_scheduler(*scheduler, processes, run.metrics);
+    } catch (const std::exception& e) {
+        run.error = e.what();
+    }
+    
+    return run;
+}
+
+double ExperimentRunner::run_scheduler(Scheduler& scheduler, const std::vector<Process>& processes,
+                                       MetricsSummary& metrics) {
+    // Only the totals are needed, so the chart is never materialized
+    GanttMetricsSink sink;
+    scheduler.set_gantt_sink(&sink);
+    scheduler.load_processes(processes);
+    
+    auto started = std::chrono::steady_clock::now();
+    scheduler.schedule();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    
+    metrics = PerformanceMetrics::view(scheduler.get_processes(), sink.summary()).summary();
+    return seconds;
+}
+
+std::vector<QuantumRun> ExperimentRunner::sweep_round_robin(const std::vector<Process>& processes,
+                                                            int min_quantum, int max_quantum, int step,
+                                                            unsigned threads, const SwitchCost& cost) {
+    if (min_quantum <= 0 || max_quantum < min_quantum || step <= 0) {
+        throw std::runtime_error("Invalid quantum range: need 0 < min <= max and step > 0");
+    }
+    
+    std::vector<QuantumRun> runs;
+    for (int q = min_quantum; q <= max_quantum; q += step) {
+        QuantumRun run;
+        run.quantum = q;
+        runs.push_back(run);
+        if (q > max_quantum - step) break;  // avoid overflow near INT_MAX
+    }
+    
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = static_cast<unsigned>(std::min<size_t>(threads, runs.size()));
+    
+    // Workers pull quanta from a shared counter, so long runs (small quanta)
+    // don't hold up a statically assigned batch
+    std::atomic<size_t> next(0);
+    std::exception_ptr failure;
+    std::atomic<bool> failed(false);
+    auto worker = [&]() {
+        for (size_t i = next++; i < runs.size() && !failed; i = next++) {
+            try {
+                std::unique_ptr<Scheduler> scheduler(create_round_robin_scheduler(runs[i].quantum));
+                scheduler->set_switch_cost(cost);
+                runs[i].seconds = run_scheduler(*scheduler, processes, runs[i].metrics);
+            } catch (...) {
+                if (!failed.exchange(true)) failure = std::current_exception();
+            }
+        }
+    };
+    
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; t++) {
+        workers.push_back(std::thread(worker));
+    }
+    worker();  // the calling thread takes a share too
+    for (auto& w : workers) {
+        w.join();
+    }
+    
+    if (failure) std::rethrow_exception(failure);
+    return runs;
+}
+
+size_t ExperimentRunner::best_quantum(const std::vector<QuantumRun>& runs, SweepObjective objective) {
+    size_t best = 0;
+    for (size_t i = 1; i < runs.size(); i++) {
+        if (runs[i].objective_value(objective) < runs[best].objective_value(objective)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+SweepObjective ExperimentRunner::parse_objective(const std::string& name) {
+    if (name == "waiting") return SweepObjective::WAITING;
+    if (name == "response") return SweepObjective::RESPONSE;
+    if (name == "turnaround") return SweepObjective::TURNAROUND;
+    if (name == "switches") return SweepObjective::CONTEXT_SWITCHES;
+    throw std::runtime_error("Unknown sweep objective: " + name);
+}
+
+std::string ExperimentRunner::objective_name(SweepObjective objective) {
+    switch (objective) {
+        case SweepObjective::WAITING:          return "average waiting time";
+        case SweepObjective::RESPONSE:         return "average response time";
+        case SweepObjective::TURNAROUND:       return "average turnaround time";
+        case SweepObjective::CONTEXT_SWITCHES: return "context switches";
+    }
+    return "";
+}
+
+void ExperimentRunner::print_comparison(const std::vector<AlgorithmRun>& runs) {
+    const int label_width = 22;
+    const int column_width = 12;
+    
+    std::cout << "\n=== Algorithm Comparison ===\n\n";
+    std::cout << std::left << std::setw(label_width) << "Metric" << std::right;
+    for (const auto& run : runs) {
+        std::cout << std::setw(column_width) << run.algorithm;
+    }
+    std::cout << "\n" << std::string(label_width + column_width * runs.size(), '-') << "\n";
+    
+    // One row per metric; failed runs show "error"
+    auto row = [&](const std::string& label, double (*value)(const AlgorithmRun&), int precision) {
+        std::cout << std::left << std::setw(label_width) << label << std::right
+                  << std::fixed << std::setprecision(precision);
+        for (const auto& run : runs) {
+            if (run.error.empty()) {
+                std::cout << std::setw(column_width) << value(run);
+            } else {
+                std::cout << std::setw(column_width) << "error";
+            }
+        }
+        std::cout << "\n";
+    };
+    
+    row("Avg Turnaround Time", [](const AlgorithmRun& r) { return r.metrics.average_turnaround_time; }, 2);
+    row("Avg Waiting Time", [](const AlgorithmRun& r) { return r.metrics.average_waiting_time; }, 2);
+    row("Avg Response Time", [](const AlgorithmRun& r) { return r.metrics.average_response_time; }, 2);
+    row("CPU Utilization (%)", [](const AlgorithmRun& r) { return r.metrics.cpu_utilization; }, 2);
+    row("Throughput", [](const AlgorithmRun& r) { return r.metrics.throughput; }, 4);
+    row("Context Switches", [](const AlgorithmRun& r) { return (double)r.metrics.context_switches; }, 0);
+    row("Fairness Index", [](const AlgorithmRun& r) { return r.metrics.fairness_index; }, 2);
+    row("Makespan", [](const AlgorithmRun& r) { return (double)r.metrics.total_time; }, 0);
+    row("Simulation Time (ms)", [](const AlgorithmRun& r) { return r.seconds * 1000.0; }, 2);
+    std::cout << "\n";
+    
+    for (const auto& run : runs) {
+        if (!run.error.empty()) {
+            std::cout << "Error (" << run.algorithm << "): " << run.error << "\n";
+        }
+    }
+}
+
+void ExperimentRunner::print_sweep(const std::vector<QuantumRun>& runs, SweepObjective objective) {
+    if (runs.empty()) return;
+    const size_t best = best_quantum(runs, objective);
+    
+    std::cout << "\n=== Round Robin Quantum Sweep ===\n\n";
+    std::cout << std::setw(8) << "Quantum" << std::setw(14) << "Avg Waiting"
+              << std::setw(14) << "Avg Response" << std::setw(16) << "Avg Turnaround"
+              << std::setw(12) << "Switches" << "\n";
+    std::cout << std::string(64, '-') << "\n";
+    
+    std::cout << std::fixed << std::setprecision(2);
+    for (size_t i = 0; i < runs.size(); i++) {
+        const QuantumRun& run = runs[i];
+        std::cout << std::setw(8) << run.quantum
+                  << std::setw(14) << run.metrics.average_waiting_time
+                  << std::setw(14) << run.metrics.average_response_time
+                  << std::setw(16) << run.metrics.average_turnaround_time
+                  << std::setw(12) << run.metrics.context_switches
+                  << (i == best ? "  <- best" : "") << "\n";
+    }
+    
+    std::cout << "\nBest quantum by " << objective_name(objective) << ": " << runs[best].quantum
+              << " (" << runs[best].objective_value(objective) << ")\n";
+}
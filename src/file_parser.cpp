@@ -1,8 +1,130 @@
 #include "file_parser.h"
+#include "mapped_file.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <stdexcept>
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <thread>
+#include <exception>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// A token inside the input buffer, [begin, end)
+struct Token {
+    const char* begin;
+    const char* end;
+};
+
+enum IntStatus { INT_OK, INT_INVALID, INT_OUT_OF_RANGE };
+
+// Same acceptance rules as std::stoi: leading whitespace, optional sign,
+// at least one digit, trailing characters ignored
+IntStatus parse_int(const Token& token, int& value) {
+    const char* p = token.begin;
+    while (p < token.end && (*p == ' ' || (*p >= '\t' && *p <= '\r'))) p++;
+    
+    bool negative = false;
+    if (p < token.end && (*p == '+' || *p == '-')) {
+        negative = (*p == '-');
+        p++;
+    }
+    if (p == token.end || *p < '0' || *p > '9') return INT_INVALID;
+    
+    const long long limit = negative ? -static_cast<long long>(INT_MIN) : INT_MAX;
+    long long magnitude = 0;
+    bool overflow = false;
+    for (; p < token.end && *p >= '0' && *p <= '9'; p++) {
+        magnitude = magnitude * 10 + (*p - '0');
+        if (magnitude > limit) {
+            overflow = true;
+            magnitude = limit;  // keep consuming digits without overflowing
+        }
+    }
+    if (overflow) return INT_OUT_OF_RANGE;
+    
+    value = static_cast<int>(negative ? -magnitude : magnitude);
+    return INT_OK;
+}
+
+const char* int_error(IntStatus status) {
+    return status == INT_INVALID ? "Invalid number format in process data"
+                                 : "Number out of range in process data";
+}
+
+// Parses the burst column: one CPU burst ("5"), or CPU and I/O bursts
+// alternating and separated by commas ("4,3,2"), starting and ending with
+// CPU. `burst_time` gets the CPU total; `bursts` gets the sequence, or is
+// left empty for a single burst. Returns an error message or nullptr.
+const char* parse_bursts(const Token& token, int& burst_time, std::vector<int>& bursts) {
+    bursts.clear();
+    const char* comma = static_cast<const char*>(std::memchr(token.begin, ',', token.end - token.begin));
+    if (!comma) {
+        IntStatus status = parse_int(token, burst_time);
+        return status == INT_OK ? nullptr : int_error(status);
+    }
+    
+    long long cpu = 0;
+    for (const char* p = token.begin; ; ) {
+        const char* stop = static_cast<const char*>(std::memchr(p, ',', token.end - p));
+        Token piece = {p, stop ? stop : token.end};
+        int value = 0;
+        IntStatus status = parse_int(piece, value);
+        if (status != INT_OK) return int_error(status);
+        if (value <= 0) {
+            return bursts.size() % 2 == 0 ? "Burst time must be positive" : "I/O time must be positive";
+        }
+        if (bursts.size() % 2 == 0) cpu += value;
+        bursts.push_back(value);
+        if (!stop) break;
+        p = stop + 1;
+    }
+    if (bursts.size() % 2 == 0) return "Burst sequence must start and end with a CPU burst";
+    if (cpu > INT_MAX) return "Number out of range in process data";
+    burst_time = static_cast<int>(cpu);
+    return nullptr;
+}
+
+inline bool is_blank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+inline bool is_placeholder(const char* begin, const char* end) {
+    return end - begin == 1 && *begin == '-';
+}
+
+// The deadline/period columns start with a number or a "-" placeholder.
+// Anything else after the name is free text and ignored, as it always was.
+inline bool has_timing_columns(const char* begin, const char* end) {
+    if (is_placeholder(begin, end)) return true;
+    if (begin < end && (*begin == '-' || *begin == '+')) begin++;
+    return begin < end && *begin >= '0' && *begin <= '9';
+}
+
+// Stores the optional deadline (relative to arrival) and period columns on
+// `process`. A periodic task without a deadline gets an implicit deadline of
+// one period. Returns an error message, or nullptr if the values are valid.
+const char* set_timing(Process& process, bool has_deadline, int relative, int period) {
+    if (period < 0) return "Period cannot be negative";
+    if (!has_deadline && period > 0) {
+        has_deadline = true;
+        relative = period;
+    }
+    if (has_deadline) {
+        if (relative <= 0) return "Deadline must be positive";
+        if (relative > INT_MAX - process.arrival_time) return "Number out of range in process data";
+        process.deadline = process.arrival_time + relative;
+    }
+    process.period = period;
+    return nullptr;
+}
+
+} // namespace
 
 std::vector<Process> FileParser::parse_file(const std::string& filename) {
     std::ifstream file(filename);
@@ -22,8 +144,7 @@ std::vector<Process> FileParser::parse_file(const std::string& filename) {
         }
         
         try {
-            Process process = parse_process_line(line, line_number);
-            processes.push_back(process);
+            processes.push_back(parse_process_line(line, line_number));
         } catch (const std::exception& e) {
             std::cerr << "Error parsing line " << line_number << ": " << e.what() << "\n";
             std::cerr << "Line content: " << line << "\n";
@@ -39,6 +160,150 @@ std::vector<Process> FileParser::parse_file(const std::string& filename) {
     return processes;
 }
 
+std::vector<Process> FileParser::parse_file_fast(const std::string& filename, ParseStats* stats) {
+    auto started = std::chrono::steady_clock::now();
+    
+    MappedFile file(filename);
+    std::vector<Process> processes;
+    std::vector<ParseDiagnostic> diagnostics;
+    size_t lines = parse_range(file.data(), file.data() + file.size(), 1, processes, diagnostics);
+    report_diagnostics(diagnostics);
+    
+    if (stats) {
+        stats->lines = lines;
+        stats->processes = processes.size();
+        stats->errors = diagnostics.size();
+        stats->diagnostics = diagnostics;
+        stats->bytes = file.size();
+        stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    }
+    
+    if (processes.empty()) {
+        throw std::runtime_error("No valid processes found in file: " + filename);
+    }
+    
+    return processes;
+}
+
+std::vector<Process> FileParser::parse_buffer(const char* data, size_t size, ParseStats* stats) {
+    auto started = std::chrono::steady_clock::now();
+    
+    std::vector<Process> processes;
+    std::vector<ParseDiagnostic> diagnostics;
+    size_t lines = parse_range(data, data + size, 1, processes, diagnostics);
+    report_diagnostics(diagnostics);
+    
+    if (stats) {
+        stats->lines = lines;
+        stats->processes = processes.size();
+        stats->errors = diagnostics.size();
+        stats->diagnostics = diagnostics;
+        stats->bytes = size;
+        stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    }
+    
+    return processes;
+}
+
+std::vector<Process> FileParser::parse_file_parallel(const std::string& filename, unsigned threads,
+                                                     ParseStats* stats) {
+    auto started = std::chrono::steady_clock::now();
+    
+    MappedFile file(filename);
+    std::vector<Process> processes = parse_buffer_parallel(file.data(), file.size(), threads, stats);
+    
+    if (stats) {
+        stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    }
+    
+    if (processes.empty()) {
+        throw std::runtime_error("No valid processes found in file: " + filename);
+    }
+    
+    return processes;
+}
+
+std::vector<Process> FileParser::parse_buffer_parallel(const char* data, size_t size, unsigned threads,
+                                                       ParseStats* stats) {
+    auto started = std::chrono::steady_clock::now();
+    
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    
+    // Chunks of at least 1 MiB; smaller inputs are not worth a thread
+    const size_t min_chunk = 1 << 20;
+    size_t chunks = std::min<size_t>(threads, std::max<size_t>(1, size / min_chunk));
+    
+    // Chunk k covers [bounds[k], bounds[k+1]); every boundary follows a newline
+    std::vector<size_t> bounds(chunks + 1, size);
+    bounds[0] = 0;
+    for (size_t k = 1; k < chunks; k++) {
+        size_t pos = std::max(bounds[k - 1], size / chunks * k);
+        const char* newline = pos < size
+            ? static_cast<const char*>(std::memchr(data + pos, '\n', size - pos)) : nullptr;
+        bounds[k] = newline ? static_cast<size_t>(newline - data) + 1 : size;
+    }
+    
+    // Each worker numbers its lines from 1; fixed up once all are done
+    std::vector<std::vector<Process> > parts(chunks);
+    std::vector<std::vector<ParseDiagnostic> > part_diagnostics(chunks);
+    std::vector<size_t> part_lines(chunks, 0);
+    std::vector<std::exception_ptr> failures(chunks);
+    
+    auto work = [&](size_t k) {
+        try {
+            part_lines[k] = parse_range(data + bounds[k], data + bounds[k + 1], 1,
+                                        parts[k], part_diagnostics[k]);
+        } catch (...) {
+            failures[k] = std::current_exception();
+        }
+    };
+    
+    std::vector<std::thread> workers;
+    for (size_t k = 1; k < chunks; k++) {
+        workers.push_back(std::thread(work, k));
+    }
+    work(0);  // The calling thread takes the first chunk
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (const auto& failure : failures) {
+        if (failure) std::rethrow_exception(failure);
+    }
+    
+    // Merge in chunk order, shifting diagnostics to file line numbers
+    size_t total = 0;
+    for (const auto& part : parts) total += part.size();
+    
+    std::vector<Process> processes;
+    processes.reserve(total);
+    std::vector<ParseDiagnostic> diagnostics;
+    size_t line_base = 0;
+    for (size_t k = 0; k < chunks; k++) {
+        processes.insert(processes.end(), parts[k].begin(), parts[k].end());
+        std::vector<Process>().swap(parts[k]);
+        for (auto& d : part_diagnostics[k]) {
+            d.line_number += static_cast<int>(line_base);
+            diagnostics.push_back(d);
+        }
+        line_base += part_lines[k];
+    }
+    report_diagnostics(diagnostics);
+    
+    if (stats) {
+        stats->lines = line_base;
+        stats->processes = processes.size();
+        stats->errors = diagnostics.size();
+        stats->diagnostics = diagnostics;
+        stats->bytes = size;
+        stats->threads = static_cast<unsigned>(chunks);
+        stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    }
+    
+    return processes;
+}
+
 std::vector<Process> FileParser::parse_string(const std::string& data) {
     std::vector<Process> processes;
     std::istringstream stream(data);
@@ -53,8 +318,7 @@ std::vector<Process> FileParser::parse_string(const std::string& data) {
         }
         
         try {
-            Process process = parse_process_line(line, line_number);
-            processes.push_back(process);
+            processes.push_back(parse_process_line(line, line_number));
         } catch (const std::exception& e) {
             std::cerr << "Error parsing line " << line_number << ": " << e.what() << "\n";
         }
@@ -63,6 +327,45 @@ std::vector<Process> FileParser::parse_string(const std::string& data) {
     return processes;
 }
 
+std::vector<Process> FileParser::expand_periodic(const std::vector<Process>& tasks, int horizon) {
+    std::vector<Process> jobs(tasks);
+    
+    // Later releases as (arrival, task index), numbered in release order
+    std::vector<std::pair<int, size_t> > releases;
+    int max_pid = 0;
+    for (size_t i = 0; i < tasks.size(); i++) {
+        const Process& task = tasks[i];
+        max_pid = std::max(max_pid, task.pid);
+        jobs[i].period = 0;
+        if (task.period <= 0) continue;
+        for (long long arrival = static_cast<long long>(task.arrival_time) + task.period;
+             arrival < horizon; arrival += task.period) {
+            releases.push_back(std::make_pair(static_cast<int>(arrival), i));
+        }
+    }
+    std::sort(releases.begin(), releases.end());
+    
+    if (releases.size() > static_cast<size_t>(INT_MAX - max_pid)) {
+        throw std::runtime_error("Too many periodic releases before the horizon");
+    }
+    jobs.reserve(jobs.size() + releases.size());
+    int next_pid = max_pid;
+    for (const auto& release : releases) {
+        Process job = tasks[release.second];
+        const int shift = release.first - job.arrival_time;
+        job.pid = ++next_pid;
+        job.arrival_time = release.first;
+        if (job.has_deadline()) {
+            job.deadline = job.deadline > INT_MAX - shift ? INT_MAX : job.deadline + shift;
+        }
+        job.period = 0;
+        job.reset_for_simulation();
+        jobs.push_back(job);
+    }
+    
+    return jobs;
+}
+
 void FileParser::generate_sample_files() {
     // Create test_data directory if it doesn't exist
     std::ofstream simple("test_data/simple.txt");
@@ -146,7 +449,16 @@ Process FileParser::parse_process_line(const std::string& line, int line_number)
     try {
         int pid = std::stoi(tokens[0]);
         int arrival_time = std::stoi(tokens[1]);
-        int burst_time = std::stoi(tokens[2]);
+        int burst_time = 0;
+        std::vector<int> bursts;
+        if (tokens[2].find(',') == std::string::npos) {
+            burst_time = std::stoi(tokens[2]);
+        } else {
+            Token column = {tokens[2].data(), tokens[2].data() + tokens[2].size()};
+            if (const char* error = parse_bursts(column, burst_time, bursts)) {
+                throw std::runtime_error(error);
+            }
+        }
         
         // Validate basic constraints
         if (pid < 0) throw std::runtime_error("PID cannot be negative");
@@ -159,13 +471,27 @@ Process FileParser::parse_process_line(const std::string& line, int line_number)
             priority = std::stoi(tokens[3]);
         }
         
-        // Optional name (default = "P" + pid)
+        // Optional name (default = "P" + pid; "-" = default)
         std::string name = "";
-        if (tokens.size() >= 5) {
+        if (tokens.size() >= 5 && tokens[4] != "-") {
             name = tokens[4];
         }
         
-        return Process(pid, arrival_time, burst_time, priority, name);
+        // Optional deadline relative to arrival ("-" = none) and period
+        const bool timing = tokens.size() >= 6 &&
+            has_timing_columns(tokens[5].data(), tokens[5].data() + tokens[5].size());
+        const bool has_deadline = timing && tokens[5] != "-";
+        int relative = has_deadline ? std::stoi(tokens[5]) : 0;
+        int period = timing && tokens.size() >= 7 ? std::stoi(tokens[6]) : 0;
+        
+        Process process(pid, arrival_time, burst_time, priority, name);
+        if (!bursts.empty()) {
+            process.set_bursts(bursts);
+        }
+        if (const char* error = set_timing(process, has_deadline, relative, period)) {
+            throw std::runtime_error(error);
+        }
+        return process;
         
     } catch (const std::invalid_argument& e) {
         throw std::runtime_error("Invalid number format in process data");
@@ -173,3 +499,113 @@ Process FileParser::parse_process_line(const std::string& line, int line_number)
         throw std::runtime_error("Number out of range in process data");
     }
 }
+
+size_t FileParser::parse_range(const char* begin, const char* end, int first_line,
+                               std::vector<Process>& out, std::vector<ParseDiagnostic>& diagnostics) {
+    size_t lines = 0;
+    int line_number = first_line - 1;
+    const char* p = begin;
+    
+    const size_t max_cached_names = 4096;
+    std::unordered_map<std::string, uint32_t> name_cache;
+    std::string name;
+    std::vector<int> bursts;
+    
+    while (p < end) {
+        const char* newline = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        const char* line_end = newline ? newline : end;
+        const char* line_begin = p;
+        p = newline ? newline + 1 : end;
+        line_number++;
+        lines++;
+        
+        // Skip comments and blank lines
+        const char* first = line_begin;
+        while (first < line_end && is_blank(*first)) first++;
+        if (first == line_end || *first == '#') continue;
+        
+        // Split on spaces, trimming spaces and tabs around each token
+        Token tokens[7];
+        size_t count = 0;
+        for (const char* q = line_begin; q < line_end; ) {
+            const char* stop = q;
+            while (stop < line_end && *stop != ' ') stop++;
+            
+            const char* b = q;
+            const char* e = stop;
+            while (b < e && is_blank(*b)) b++;
+            while (e > b && is_blank(e[-1])) e--;
+            if (b < e) {
+                if (count < 7) {
+                    tokens[count].begin = b;
+                    tokens[count].end = e;
+                }
+                count++;
+            }
+            q = stop + 1;
+        }
+        
+        const char* error = nullptr;
+        int pid = 0, arrival_time = 0, burst_time = 0, priority = 0, relative = 0, period = 0;
+        const bool timing = count >= 6 && has_timing_columns(tokens[5].begin, tokens[5].end);
+        const bool has_deadline = timing && !is_placeholder(tokens[5].begin, tokens[5].end);
+        IntStatus status = INT_OK;
+        
+        if (count < 3) {
+            error = "Insufficient data - need at least PID, arrival time, and burst time";
+        } else if ((status = parse_int(tokens[0], pid)) != INT_OK ||
+                   (status = parse_int(tokens[1], arrival_time)) != INT_OK) {
+            error = int_error(status);
+        } else if (const char* burst_error = parse_bursts(tokens[2], burst_time, bursts)) {
+            error = burst_error;
+        } else if (pid < 0) {
+            error = "PID cannot be negative";
+        } else if (arrival_time < 0) {
+            error = "Arrival time cannot be negative";
+        } else if (burst_time <= 0) {
+            error = "Burst time must be positive";
+        } else if (count >= 4 && (status = parse_int(tokens[3], priority)) != INT_OK) {
+            error = int_error(status);
+        } else if ((has_deadline && (status = parse_int(tokens[5], relative)) != INT_OK) ||
+                   (timing && count >= 7 && (status = parse_int(tokens[6], period)) != INT_OK)) {
+            error = int_error(status);
+        }
+        
+        Process process(pid, arrival_time, burst_time, priority);
+        if (!error && !bursts.empty()) {
+            process.set_bursts(bursts);
+        }
+        if (!error) {
+            error = set_timing(process, has_deadline, relative, period);
+        }
+        if (error) {
+            diagnostics.push_back(ParseDiagnostic(line_number, error, std::string(line_begin, line_end)));
+            continue;
+        }
+        
+        if (count >= 5 && !is_placeholder(tokens[4].begin, tokens[4].end)) {
+            // Repeated names are resolved locally so parallel workers rarely
+            // contend on the NameTable lock
+            name.assign(tokens[4].begin, tokens[4].end);
+            auto cached = name_cache.find(name);
+            if (cached != name_cache.end()) {
+                process.name_id = cached->second;
+            } else {
+                process.set_name(name);
+                if (name_cache.size() < max_cached_names) {
+                    name_cache.insert(std::make_pair(name, process.name_id));
+                }
+            }
+        }
+        out.push_back(process);
+    }
+    
+    return lines;
+}
+
+void FileParser::report_diagnostics(const std::vector<ParseDiagnostic>& diagnostics) {
+    for (const auto& d : diagnostics) {
+        std::cerr << "Error parsing line " << d.line_number << ": " << d.message << "\n";
+        std::cerr << "Line content: " << d.line << "\n";
+    }
+}
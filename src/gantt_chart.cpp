@@ -3,25 +3,177 @@
 #include <iomanip>
 #include <algorithm>
 
+namespace {
+
+// LEB128-style unsigned varint
+void put_varint(std::vector<uint8_t>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+uint32_t get_varint(const std::vector<uint8_t>& in, size_t& pos) {
+    uint32_t value = 0;
+    int shift = 0;
+    while (true) {
+        uint8_t byte = in[pos++];
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) break;
+        shift += 7;
+    }
+    return value;
+}
+
+// Zigzag mapping so small negative deltas (overlaps) stay short
+uint32_t zigzag_encode(int value) {
+    return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+}
+
+int zigzag_decode(uint32_t value) {
+    return static_cast<int>(value >> 1) ^ -static_cast<int>(value & 1);
+}
+
+} // namespace
+
+GanttChart::const_iterator::const_iterator(const GanttChart* chart, size_t index)
+    : chart(chart), index(index), byte_pos(0), prev_end(0), current(-1, 0, 0) {
+    if (index < chart->size()) {
+        load();
+    }
+}
+
+GanttChart::const_iterator& GanttChart::const_iterator::operator++() {
+    index++;
+    if (index < chart->size()) {
+        load();
+    }
+    return *this;
+}
+
+GanttChart::const_iterator GanttChart::const_iterator::operator++(int) {
+    const_iterator before = *this;
+    ++(*this);
+    return before;
+}
+
+void GanttChart::const_iterator::load() {
+    if (!chart->compact_mode) {
+        current = chart->entries[index];
+    } else if (index < chart->compact_pids.size()) {
+        // Encoded entries are decoded in order, so this runs once per index
+        int start = prev_end + zigzag_decode(get_varint(chart->compact_timing, byte_pos));
+        int end = start + static_cast<int>(get_varint(chart->compact_timing, byte_pos));
+        current = GanttEntry(chart->compact_pids[index], start, end);
+        prev_end = end;
+    } else {
+        current = GanttEntry(chart->tail_pid, chart->tail_start, chart->tail_end);
+    }
+}
+
+GanttChart::GanttChart()
+    : compact_mode(false), encoded_end(0), has_tail(false),
+      tail_pid(-1), tail_start(0), tail_end(0), decoded_valid(false) {}
+
 void GanttChart::add_entry(int pid, int start_time, int end_time) {
     if (start_time >= end_time) {
         std::cerr << "Error: Invalid time range for Gantt entry\n";
         return;
     }
+    decoded_valid = false;
+    
+    if (!compact_mode) {
+        entries.push_back(GanttEntry(pid, start_time, end_time));
+        return;
+    }
+    
+    flush_tail();
+    has_tail = true;
+    tail_pid = pid;
+    tail_start = start_time;
+    tail_end = end_time;
+}
+
+void GanttChart::add_coalesced(int pid, int start_time, int end_time) {
+    if (start_time >= end_time) {
+        std::cerr << "Error: Invalid time range for Gantt entry\n";
+        return;
+    }
     
-    entries.push_back(GanttEntry(pid, start_time, end_time));
+    if (compact_mode) {
+        if (has_tail && tail_pid == pid && tail_end == start_time) {
+            tail_end = end_time;
+            decoded_valid = false;
+            return;
+        }
+    } else if (!entries.empty() && entries.back().pid == pid &&
+               entries.back().end_time == start_time) {
+        entries.back().end_time = end_time;
+        decoded_valid = false;
+        return;
+    }
+    
+    add_entry(pid, start_time, end_time);
 }
 
 void GanttChart::add_idle(int start_time, int end_time) {
     add_entry(-1, start_time, end_time);  // -1 represents idle time
 }
 
+void GanttChart::add_io(int pid, int start_time, int end_time) {
+    io_entries.push_back(GanttEntry(pid, start_time, end_time));
+}
+
 void GanttChart::clear() {
     entries.clear();
+    io_entries.clear();
+    compact_pids.clear();
+    compact_timing.clear();
+    encoded_end = 0;
+    has_tail = false;
+    decoded.clear();
+    decoded_valid = false;
+}
+
+void GanttChart::record(int pid, int start_time, int end_time) {
+    add_coalesced(pid, start_time, end_time);
+}
+
+void GanttChart::record_io(int pid, int start_time, int end_time) {
+    add_io(pid, start_time, end_time);
+}
+
+void GanttChart::reset() {
+    clear();
+}
+
+void GanttChart::set_compact(bool compact) {
+    if (compact == compact_mode) return;
+    
+    if (compact) {
+        std::vector<GanttEntry> expanded;
+        expanded.swap(entries);
+        compact_mode = true;
+        for (const auto& entry : expanded) {
+            add_entry(entry.pid, entry.start_time, entry.end_time);
+        }
+    } else {
+        std::vector<GanttEntry> expanded(begin(), end());
+        clear();
+        compact_mode = false;
+        entries.swap(expanded);
+    }
+    decoded.clear();
+    decoded_valid = false;
+}
+
+bool GanttChart::is_compact() const {
+    return compact_mode;
 }
 
 void GanttChart::print() const {
-    if (entries.empty()) {
+    if (empty()) {
         std::cout << "Empty Gantt Chart\n";
         return;
     }
@@ -30,9 +182,11 @@ void GanttChart::print() const {
     
     // Print process names/IDs
     std::cout << "|";
-    for (const auto& entry : entries) {
+    for (const auto& entry : *this) {
         if (entry.is_idle()) {
             std::cout << std::setw(entry.duration() * 2) << "IDLE" << "|";
+        } else if (entry.is_overhead()) {
+            std::cout << std::setw(entry.duration() * 2) << "CS" << "|";
         } else {
             std::cout << std::setw(entry.duration() * 2) << ("P" + std::to_string(entry.pid)) << "|";
         }
@@ -41,17 +195,27 @@ void GanttChart::print() const {
     
     // Print time line
     std::cout << "0";
-    for (const auto& entry : entries) {
+    for (const auto& entry : *this) {
         for (int i = 0; i < entry.duration() * 2 - 1; i++) {
             std::cout << "-";
         }
         std::cout << entry.end_time;
     }
-    std::cout << "\n\n";
+    std::cout << "\n";
+    
+    // I/O lane
+    if (!io_entries.empty()) {
+        std::cout << "I/O:";
+        for (const auto& io : io_entries) {
+            std::cout << " P" << io.pid << "[" << io.start_time << "-" << io.end_time << "]";
+        }
+        std::cout << "\n";
+    }
+    std::cout << "\n";
 }
 
 void GanttChart::print_detailed() const {
-    if (entries.empty()) {
+    if (empty()) {
         std::cout << "Empty Gantt Chart\n";
         return;
     }
@@ -60,30 +224,64 @@ void GanttChart::print_detailed() const {
     std::cout << "Time\tProcess\tDuration\n";
     std::cout << "----\t-------\t--------\n";
     
-    for (const auto& entry : entries) {
+    for (const auto& entry : *this) {
         std::cout << entry.start_time << "-" << entry.end_time << "\t";
         if (entry.is_idle()) {
             std::cout << "IDLE";
+        } else if (entry.is_overhead()) {
+            std::cout << "SWITCH";
         } else {
             std::cout << "P" << entry.pid;
         }
         std::cout << "\t" << entry.duration() << "\n";
     }
+    for (const auto& io : io_entries) {
+        std::cout << io.start_time << "-" << io.end_time << "\tP" << io.pid << " I/O\t" << io.duration() << "\n";
+    }
     std::cout << "\n";
 }
 
+GanttChart::const_iterator GanttChart::begin() const {
+    return const_iterator(this, 0);
+}
+
+GanttChart::const_iterator GanttChart::end() const {
+    return const_iterator(this, size());
+}
+
+size_t GanttChart::size() const {
+    if (compact_mode) {
+        return compact_pids.size() + (has_tail ? 1 : 0);
+    }
+    return entries.size();
+}
+
+bool GanttChart::empty() const {
+    return size() == 0;
+}
+
+const std::vector<GanttEntry>& GanttChart::get_io_entries() const {
+    return io_entries;
+}
+
 const std::vector<GanttEntry>& GanttChart::get_entries() const {
-    return entries;
+    if (!compact_mode) return entries;
+    
+    if (!decoded_valid) {
+        decoded.assign(begin(), end());
+        decoded_valid = true;
+    }
+    return decoded;
 }
 
 int GanttChart::get_total_time() const {
-    if (entries.empty()) return 0;
-    return entries.back().end_time;
+    if (empty()) return 0;
+    return compact_mode ? tail_end : entries.back().end_time;
 }
 
 int GanttChart::get_total_idle_time() const {
     int idle_time = 0;
-    for (const auto& entry : entries) {
+    for (const auto& entry : *this) {
         if (entry.is_idle()) {
             idle_time += entry.duration();
         }
@@ -99,20 +297,118 @@ double GanttChart::get_cpu_utilization() const {
     return (double)active_time / total_time * 100.0;
 }
 
-bool GanttChart::is_valid() const {
-    if (entries.empty()) return true;
+GanttSummary GanttChart::summarize() const {
+    GanttSummary summary;
+    int prev_pid = -1;  // Nothing ran before the first entry
+    for (const auto& entry : *this) {
+        summary.slices++;
+        if (entry.is_overhead()) {
+            summary.overhead_time += entry.duration();
+            continue;  // Part of the switch that follows
+        }
+        if (entry.is_idle()) {
+            summary.idle_time += entry.duration();
+        } else if (prev_pid != -1 && prev_pid != entry.pid) {
+            summary.context_switches++;
+        }
+        prev_pid = entry.pid;
+    }
+    summary.total_time = get_total_time();
+    if (!io_entries.empty()) {
+        summarize_io(summary);
+    }
+    return summary;
+}
+
+void GanttChart::summarize_io(GanttSummary& summary) const {
+    std::vector<GanttEntry> waits(io_entries);
+    std::sort(waits.begin(), waits.end(), [](const GanttEntry& a, const GanttEntry& b) {
+        return a.start_time < b.start_time;
+    });
     
-    // Check for gaps or overlaps
-    for (size_t i = 1; i < entries.size(); i++) {
-        if (entries[i-1].end_time != entries[i].start_time) {
-            return false;  // Gap or overlap found
+    // Union of the waits: the periods with some job in I/O
+    std::vector<GanttEntry> busy;
+    for (const auto& wait : waits) {
+        summary.io_time += wait.duration();
+        if (!busy.empty() && wait.start_time <= busy.back().end_time) {
+            busy.back().end_time = std::max(busy.back().end_time, wait.end_time);
+        } else {
+            busy.push_back(wait);
         }
     }
     
+    // Intersect with the slices that ran a job; both lists are in time order
+    size_t next = 0;
+    for (const auto& entry : *this) {
+        if (entry.is_idle() || entry.is_overhead()) continue;
+        while (next < busy.size() && busy[next].end_time <= entry.start_time) next++;
+        for (size_t i = next; i < busy.size() && busy[i].start_time < entry.end_time; i++) {
+            summary.io_overlap_time += std::min(entry.end_time, busy[i].end_time) -
+                                       std::max(entry.start_time, busy[i].start_time);
+        }
+    }
+    for (const auto& period : busy) {
+        summary.io_busy_time += period.duration();
+    }
+}
+
+GanttSummary GanttSummary::combine(const std::vector<GanttSummary>& per_cpu) {
+    GanttSummary combined;
+    combined.cpus = 0;
+    for (const auto& cpu : per_cpu) {
+        combined.total_time = std::max(combined.total_time, cpu.total_time);
+    }
+    for (const auto& cpu : per_cpu) {
+        combined.idle_time += cpu.idle_time + (combined.total_time - cpu.total_time);
+        combined.overhead_time += cpu.overhead_time;
+        combined.context_switches += cpu.context_switches;
+        combined.slices += cpu.slices;
+        combined.cpus += cpu.cpus;
+    }
+    if (combined.cpus == 0) combined.cpus = 1;
+    return combined;
+}
+
+size_t GanttChart::get_memory_usage() const {
+    const size_t io_bytes = io_entries.capacity() * sizeof(GanttEntry);
+    if (compact_mode) {
+        return compact_pids.capacity() * sizeof(int32_t) + compact_timing.capacity() + io_bytes;
+    }
+    return entries.capacity() * sizeof(GanttEntry) + io_bytes;
+}
+
+bool GanttChart::is_valid() const {
+    if (empty()) return true;
+    
+    // Check for gaps or overlaps
+    const_iterator it = begin();
+    
     // Check that first entry starts at 0 or later
-    if (entries[0].start_time < 0) {
+    if (it->start_time < 0) {
         return false;
     }
     
+    int prev_end = it->end_time;
+    for (++it; it != end(); ++it) {
+        if (prev_end != it->start_time) {
+            return false;  // Gap or overlap found
+        }
+        prev_end = it->end_time;
+    }
+    
     return true;
 }
+
+void GanttChart::append_encoded(int pid, int start_time, int end_time) {
+    compact_pids.push_back(pid);
+    put_varint(compact_timing, zigzag_encode(start_time - encoded_end));
+    put_varint(compact_timing, static_cast<uint32_t>(end_time - start_time));
+    encoded_end = end_time;
+}
+
+void GanttChart::flush_tail() {
+    if (has_tail) {
+        append_encoded(tail_pid, tail_start, tail_end);
+        has_tail = false;
+    }
+}
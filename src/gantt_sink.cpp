@@ -0,0 +1,96 @@
+#include "gantt_sink.h"
+#include <stdexcept>
+
+GanttMetricsSink::GanttMetricsSink()
+    : has_last(false), last_pid(-1), last_end(0), last_switch_pid(-1) {}
+
+void GanttMetricsSink::record(int pid, int start_time, int end_time) {
+    if (start_time >= end_time) return;
+    
+    const int duration = end_time - start_time;
+    if (pid == -1) {
+        totals.idle_time += duration;
+    } else if (pid == -2) {
+        totals.overhead_time += duration;
+    }
+    
+    // Same rules as GanttChart: touching slices of one PID are one slice, and
+    // a switch is two adjacent non-idle slices with different PIDs, not
+    // counting the overhead slices between them
+    if (!(has_last && pid == last_pid && start_time == last_end)) {
+        totals.slices++;
+    }
+    if (pid != -2) {
+        if (last_switch_pid != -1 && pid != -1 && pid != last_switch_pid) {
+            totals.context_switches++;
+        }
+        last_switch_pid = pid;
+    }
+    
+    has_last = true;
+    last_pid = pid;
+    last_end = end_time;
+    totals.total_time = end_time;
+}
+
+void GanttMetricsSink::reset() {
+    totals = GanttSummary();
+    has_last = false;
+    last_pid = -1;
+    last_end = 0;
+    last_switch_pid = -1;
+}
+
+const GanttSummary& GanttMetricsSink::summary() const {
+    return totals;
+}
+
+FileGanttSink::FileGanttSink(const std::string& filename)
+    : filename(filename), has_pending(false), pending_pid(-1), pending_start(0), pending_end(0) {
+    open_file();
+}
+
+FileGanttSink::~FileGanttSink() {
+    flush();
+}
+
+void FileGanttSink::record(int pid, int start_time, int end_time) {
+    if (start_time >= end_time) return;
+    GanttMetricsSink::record(pid, start_time, end_time);
+    
+    if (has_pending && pid == pending_pid && start_time == pending_end) {
+        pending_end = end_time;
+        return;
+    }
+    
+    if (has_pending) {
+        out << pending_start << ' ' << pending_end << ' ' << pending_pid << '\n';
+    }
+    has_pending = true;
+    pending_pid = pid;
+    pending_start = start_time;
+    pending_end = end_time;
+}
+
+void FileGanttSink::reset() {
+    GanttMetricsSink::reset();
+    has_pending = false;
+    out.close();
+    open_file();
+}
+
+void FileGanttSink::flush() {
+    if (has_pending) {
+        out << pending_start << ' ' << pending_end << ' ' << pending_pid << '\n';
+        has_pending = false;
+    }
+    out.flush();
+}
+
+void FileGanttSink::open_file() {
+    out.open(filename.c_str(), std::ios::out | std::ios::trunc);
+    if (!out.is_open()) {
+        throw std::runtime_error("Cannot open Gantt output file: " + filename);
+    }
+    out << "# start end pid (pid -1 = idle)\n";
+}
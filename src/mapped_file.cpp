@@ -0,0 +1,65 @@
+#include "mapped_file.h"
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& filename)
+    : bytes(nullptr), length(0), mapping(nullptr) {
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot open file: " + filename);
+    }
+    buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    bytes = buffer.empty() ? nullptr : buffer.data();
+    length = buffer.size();
+}
+
+MappedFile::~MappedFile() {}
+
+#else
+
+MappedFile::MappedFile(const std::string& filename)
+    : bytes(nullptr), length(0), mapping(nullptr) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open file: " + filename);
+    }
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        throw std::runtime_error("Cannot stat file: " + filename);
+    }
+    
+    length = static_cast<size_t>(info.st_size);
+    if (length > 0) {
+        void* base = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (base == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error("Cannot map file: " + filename);
+        }
+        // The whole file is read front to back
+        madvise(base, length, MADV_SEQUENTIAL);
+        mapping = base;
+        bytes = static_cast<const char*>(base);
+    }
+    close(fd);  // The mapping stays valid after the descriptor is closed
+}
+
+MappedFile::~MappedFile() {
+    if (mapping) {
+        munmap(mapping, length);
+    }
+}
+
+#endif
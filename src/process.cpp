@@ -1,52 +1,177 @@
 #include "process.h"
 #include <iostream>
 #include <sstream>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <stdexcept>
 
-Process::Process(int pid, int arrival, int burst, int priority, const std::string& name)
-    : pid(pid), name(name), arrival_time(arrival), burst_time(burst), 
-      remaining_time(burst), priority(priority), start_time(-1), 
-      completion_time(-1), waiting_time(0), turnaround_time(0), 
-      response_time(-1), has_started(false), last_run_time(-1) {
+namespace {
+
+// Storage behind NameTable. std::deque keeps references stable as it grows.
+struct NameStorage {
+    std::mutex lock;
+    std::deque<std::string> names;
+    std::unordered_map<std::string, uint32_t> ids;
+    
+    NameStorage() { names.push_back(""); }  // id 0 = no name
+};
+
+NameStorage& name_storage() {
+    static NameStorage storage;
+    return storage;
+}
+
+// Storage behind BurstTable, keyed by the sequence itself
+struct BurstHash {
+    size_t operator()(const std::vector<int>& bursts) const {
+        size_t hash = bursts.size();
+        for (int burst : bursts) {
+            hash = hash * 1000003u ^ static_cast<size_t>(burst);
+        }
+        return hash;
+    }
+};
+
+struct BurstStorage {
+    std::mutex lock;
+    std::deque<std::vector<int> > sequences;
+    std::unordered_map<std::vector<int>, uint32_t, BurstHash> ids;
+    
+    BurstStorage() { sequences.push_back(std::vector<int>()); }  // id 0 = one CPU burst
+};
+
+BurstStorage& burst_storage() {
+    static BurstStorage storage;
+    return storage;
+}
+
+} // namespace
+
+uint32_t NameTable::intern(const std::string& name) {
+    if (name.empty()) return 0;
+    
+    NameStorage& storage = name_storage();
+    std::lock_guard<std::mutex> guard(storage.lock);
+    auto it = storage.ids.find(name);
+    if (it != storage.ids.end()) {
+        return it->second;
+    }
     
-    // Set default name if not provided
-    if (this->name.empty()) {
-        this->name = "P" + std::to_string(pid);
+    uint32_t id = static_cast<uint32_t>(storage.names.size());
+    storage.names.push_back(name);
+    storage.ids.insert(std::make_pair(name, id));
+    return id;
+}
+
+std::string NameTable::lookup(uint32_t id) {
+    NameStorage& storage = name_storage();
+    std::lock_guard<std::mutex> guard(storage.lock);
+    return id < storage.names.size() ? storage.names[id] : std::string();
+}
+
+size_t NameTable::size() {
+    NameStorage& storage = name_storage();
+    std::lock_guard<std::mutex> guard(storage.lock);
+    return storage.names.size() - 1;
+}
+
+uint32_t BurstTable::intern(const std::vector<int>& bursts) {
+    if (bursts.size() <= 1) return 0;
+    
+    BurstStorage& storage = burst_storage();
+    std::lock_guard<std::mutex> guard(storage.lock);
+    auto it = storage.ids.find(bursts);
+    if (it != storage.ids.end()) {
+        return it->second;
+    }
+    
+    uint32_t id = static_cast<uint32_t>(storage.sequences.size());
+    storage.sequences.push_back(bursts);
+    storage.ids.insert(std::make_pair(bursts, id));
+    return id;
+}
+
+std::vector<int> BurstTable::lookup(uint32_t id) {
+    BurstStorage& storage = burst_storage();
+    std::lock_guard<std::mutex> guard(storage.lock);
+    return id < storage.sequences.size() ? storage.sequences[id] : std::vector<int>();
+}
+
+int BurstTable::burst(uint32_t id, int index) {
+    BurstStorage& storage = burst_storage();
+    std::lock_guard<std::mutex> guard(storage.lock);
+    const std::vector<int>& bursts = storage.sequences.at(id);
+    return index >= 0 && index < static_cast<int>(bursts.size()) ? bursts[index] : 0;
+}
+
+size_t BurstTable::size() {
+    BurstStorage& storage = burst_storage();
+    std::lock_guard<std::mutex> guard(storage.lock);
+    return storage.sequences.size() - 1;
+}
+
+Process::Process(int pid, int arrival, int burst, int priority, const std::string& name)
+    : pid(pid), arrival_time(arrival), burst_time(burst), remaining_time(burst),
+      priority(priority), deadline(-1), period(0), burst_left(burst), blocked(false), bursts_id(0),
+      io_time(0), burst_index(0), ready_time(arrival), start_time(-1), completion_time(-1), waiting_time(0),
+      turnaround_time(0), response_time(-1), last_run_time(-1), has_started(false),
+      name_id(NameTable::intern(name)) {}
+
+std::string Process::name() const {
+    // Default name if none was provided
+    if (name_id == 0) {
+        return "P" + std::to_string(pid);
     }
+    return NameTable::lookup(name_id);
+}
+
+void Process::set_name(const std::string& name) {
+    name_id = NameTable::intern(name);
 }
 
-Process::Process(const Process& other)
-    : pid(other.pid), name(other.name), arrival_time(other.arrival_time),
-      burst_time(other.burst_time), remaining_time(other.remaining_time),
-      priority(other.priority), start_time(other.start_time),
-      completion_time(other.completion_time), waiting_time(other.waiting_time),
-      turnaround_time(other.turnaround_time), response_time(other.response_time),
-      has_started(other.has_started), last_run_time(other.last_run_time) {}
-
-Process& Process::operator=(const Process& other) {
-    if (this != &other) {
-        pid = other.pid;
-        name = other.name;
-        arrival_time = other.arrival_time;
-        burst_time = other.burst_time;
-        remaining_time = other.remaining_time;
-        priority = other.priority;
-        start_time = other.start_time;
-        completion_time = other.completion_time;
-        waiting_time = other.waiting_time;
-        turnaround_time = other.turnaround_time;
-        response_time = other.response_time;
-        has_started = other.has_started;
-        last_run_time = other.last_run_time;
+void Process::set_bursts(const std::vector<int>& bursts) {
+    if (bursts.size() % 2 == 0) {
+        throw std::runtime_error("Burst sequence must start and end with a CPU burst");
+    }
+    
+    long long cpu = 0;
+    long long io = 0;
+    for (size_t i = 0; i < bursts.size(); i++) {
+        (i % 2 == 0 ? cpu : io) += bursts[i];
     }
-    return *this;
+    if (cpu > INT32_MAX || io > INT32_MAX) {
+        throw std::runtime_error("Burst sequence too long");
+    }
+    
+    bursts_id = BurstTable::intern(bursts);
+    burst_time = static_cast<int>(cpu);
+    io_time = static_cast<int>(io);
+    reset_for_simulation();
 }
 
 bool Process::is_complete() const {
     return remaining_time <= 0;
 }
 
+bool Process::is_runnable() const {
+    return !blocked && !is_complete();
+}
+
+bool Process::has_io() const {
+    return bursts_id != 0;
+}
+
+bool Process::has_deadline() const {
+    return deadline >= 0;
+}
+
 void Process::reset_for_simulation() {
     remaining_time = burst_time;
+    burst_index = 0;
+    burst_left = bursts_id != 0 ? BurstTable::burst(bursts_id, 0) : burst_time;
+    blocked = false;
+    ready_time = arrival_time;
     start_time = -1;
     completion_time = -1;
     waiting_time = 0;
@@ -62,27 +187,36 @@ void Process::calculate_metrics() {
         
         if (start_time >= 0) {
             response_time = start_time - arrival_time;
-            waiting_time = turnaround_time - burst_time;
+            waiting_time = turnaround_time - burst_time - io_time;  // I/O is not waiting
         }
     }
 }
 
 std::string Process::to_string() const {
     std::ostringstream oss;
-    oss << name << "(PID:" << pid << ", Arrival:" << arrival_time 
+    oss << name() << "(PID:" << pid << ", Arrival:" << arrival_time 
         << ", Burst:" << burst_time;
     if (priority != 0) {
         oss << ", Priority:" << priority;
     }
+    if (has_deadline()) {
+        oss << ", Deadline:" << deadline;
+    }
+    if (period > 0) {
+        oss << ", Period:" << period;
+    }
     oss << ")";
     return oss.str();
 }
 
 void Process::print_details() const {
-    std::cout << "Process " << name << " (PID " << pid << "):\n";
+    std::cout << "Process " << name() << " (PID " << pid << "):\n";
     std::cout << "  Arrival Time: " << arrival_time << "\n";
     std::cout << "  Burst Time: " << burst_time << "\n";
     std::cout << "  Priority: " << priority << "\n";
+    if (has_deadline()) {
+        std::cout << "  Deadline: " << deadline << "\n";
+    }
     
     if (has_started) {
         std::cout << "  Start Time: " << start_time << "\n";
@@ -104,3 +238,8 @@ bool Process::operator<(const Process& other) const {
     // Tie-breaking by PID
     return pid < other.pid;
 }
+
+int share_tickets(int priority) {
+    if (priority >= 99) return 1;  // Every job keeps at least one ticket
+    return 100 / (1 + (priority > 0 ? priority : 0));
+}
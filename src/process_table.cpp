@@ -0,0 +1,89 @@
+#include "process_table.h"
+
+ProcessTable::ProcessTable() {}
+
+ProcessTable::ProcessTable(const std::vector<Process>& procs) {
+    assign(procs);
+}
+
+void ProcessTable::assign(const std::vector<Process>& procs) {
+    clear();
+    reserve(procs.size());
+    for (const auto& p : procs) {
+        pid.push_back(p.pid);
+        arrival_time.push_back(p.arrival_time);
+        burst_time.push_back(p.burst_time);
+        remaining_time.push_back(p.remaining_time);
+        priority.push_back(p.priority);
+        deadline.push_back(p.deadline);
+        period.push_back(p.period);
+        name_id.push_back(p.name_id);
+        bursts_id.push_back(p.bursts_id);
+    }
+}
+
+std::vector<Process> ProcessTable::to_processes() const {
+    std::vector<Process> procs;
+    procs.reserve(size());
+    for (size_t i = 0; i < size(); i++) {
+        procs.push_back(make_process(i));
+    }
+    return procs;
+}
+
+Process ProcessTable::make_process(size_t slot) const {
+    Process p(pid[slot], arrival_time[slot], burst_time[slot], priority[slot]);
+    if (bursts_id[slot] != 0) {
+        p.set_bursts(BurstTable::lookup(bursts_id[slot]));
+    }
+    p.remaining_time = remaining_time[slot];
+    p.deadline = deadline[slot];
+    p.period = period[slot];
+    p.name_id = name_id[slot];
+    return p;
+}
+
+void ProcessTable::add(int p, int arrival, int burst, int prio, uint32_t name,
+                       int due, int every) {
+    pid.push_back(p);
+    arrival_time.push_back(arrival);
+    burst_time.push_back(burst);
+    remaining_time.push_back(burst);
+    priority.push_back(prio);
+    deadline.push_back(due);
+    period.push_back(every);
+    name_id.push_back(name);
+    bursts_id.push_back(0);
+}
+
+void ProcessTable::reserve(size_t count) {
+    pid.reserve(count);
+    arrival_time.reserve(count);
+    burst_time.reserve(count);
+    remaining_time.reserve(count);
+    priority.reserve(count);
+    deadline.reserve(count);
+    period.reserve(count);
+    name_id.reserve(count);
+    bursts_id.reserve(count);
+}
+
+void ProcessTable::clear() {
+    pid.clear();
+    arrival_time.clear();
+    burst_time.clear();
+    remaining_time.clear();
+    priority.clear();
+    deadline.clear();
+    period.clear();
+    name_id.clear();
+    bursts_id.clear();
+}
+
+size_t ProcessTable::size() const {
+    return pid.size();
+}
+
+bool ProcessTable::empty() const {
+    return pid.empty();
+}
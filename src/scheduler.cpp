@@ -2,26 +2,45 @@
 #include <iostream>
 #include <algorithm>
 #include <stdexcept>
+#include <utility>
 
 // Include all scheduler implementations
 #include "../schedulers/fcfs.cpp"
 #include "../schedulers/sjf.cpp"
 #include "../schedulers/stcf.cpp"
 #include "../schedulers/round_robin.cpp"
+#include "../schedulers/priority.cpp"
+#include "../schedulers/mlfq.cpp"
+#include "../schedulers/cfs.cpp"
+#include "../schedulers/lottery.cpp"
+#include "../schedulers/stride.cpp"
+#include "../schedulers/edf.cpp"
 
 #include <iomanip>
 
 Scheduler::Scheduler(const std::string& name) 
-    : current_time(0), algorithm_name(name) {}
+    : gantt_sink(&gantt), current_time(0), algorithm_name(name), dense_pid_index(true), remaining_jobs(0),
+      last_pid(-1) {}
 
 void Scheduler::load_processes(const std::vector<Process>& procs) {
-    processes = procs;
+    load_processes(std::vector<Process>(procs));
+}
+
+void Scheduler::load_processes(const ProcessTable& procs) {
+    load_processes(procs.to_processes());
+}
+
+void Scheduler::load_processes(std::vector<Process>&& procs) {
     original_processes = procs;  // Keep a copy for reset
+    processes = std::move(procs);
     
     // Reset all processes for simulation
     for (auto& process : processes) {
         process.reset_for_simulation();
     }
+    reindex_processes();
+    recount_remaining_jobs();
+    last_pid = -1;
 }
 
 void Scheduler::reset_simulation() {
@@ -29,7 +48,12 @@ void Scheduler::reset_simulation() {
     for (auto& process : processes) {
         process.reset_for_simulation();
     }
+    reindex_processes();
+    recount_remaining_jobs();
     gantt.clear();
+    gantt_sink->reset();
+    io_wakeups.clear();
+    last_pid = -1;
     current_time = 0;
 }
 
@@ -59,6 +83,28 @@ void Scheduler::print_gantt_chart() const {
     gantt.print();
 }
 
+void Scheduler::set_compact_gantt(bool compact) {
+    gantt.set_compact(compact);
+}
+
+void Scheduler::set_gantt_sink(GanttSink* sink) {
+    gantt_sink = sink ? sink : &gantt;
+}
+
+void Scheduler::set_switch_cost(const SwitchCost& cost) {
+    if (cost.dispatch < 0 || cost.cache_penalty < 0) {
+        throw std::runtime_error("Switch costs must not be negative");
+    }
+    if (cost.cache_decay <= 0) {
+        throw std::runtime_error("Cache decay time must be positive");
+    }
+    switch_cost = cost;
+}
+
+const SwitchCost& Scheduler::get_switch_cost() const {
+    return switch_cost;
+}
+
 const std::vector<Process>& Scheduler::get_processes() const {
     return processes;
 }
@@ -71,6 +117,10 @@ std::string Scheduler::get_algorithm_name() const {
     return algorithm_name;
 }
 
+int Scheduler::remaining_count() const {
+    return remaining_jobs;
+}
+
 void Scheduler::run_process(int pid, int duration) {
     Process* process = find_process_by_pid(pid);
     if (!process) {
@@ -83,47 +133,97 @@ void Scheduler::run_process(int pid, int duration) {
         return;
     }
     
+    if (process->is_complete()) {
+        std::cerr << "Error: Process " << pid << " already complete\n";
+        return;
+    }
+    
+    if (process->blocked) {
+        std::cerr << "Error: Process " << pid << " is blocked on I/O\n";
+        return;
+    }
+    
+    // The switch comes first, so it delays the response
+    if (switch_cost.enabled()) {
+        charge_switch(process);
+    }
+    
     // Set start time if this is the first time running
     if (!process->has_started) {
         process->start_time = current_time;
         process->has_started = true;
     }
     
-    // Update process timing
-    int actual_duration = std::min(duration, process->remaining_time);
-    process->remaining_time -= actual_duration;
-    process->last_run_time = current_time;
+    int actual_duration = account_run(process, current_time, duration);
     
-    // Add to Gantt chart
-    gantt.add_entry(pid, current_time, current_time + actual_duration);
+    // Add to Gantt chart (back-to-back slices of the same job are merged)
+    gantt_sink->record(pid, current_time, current_time + actual_duration);
     
     // Update current time
     current_time += actual_duration;
+    if (switch_cost.enabled()) {
+        off_cpu_since[process - processes.data()] = current_time;
+    }
+}
+
+void Scheduler::charge_switch(Process* process) {
+    if (process->pid == last_pid) return;
+    last_pid = process->pid;
+    
+    const int since = off_cpu_since[process - processes.data()];
+    const int overhead = switch_cost.dispatch + switch_cost.warmup(since < 0 ? -1 : current_time - since);
+    if (overhead > 0) {
+        gantt_sink->record(-2, current_time, current_time + overhead);
+        current_time += overhead;
+    }
+}
+
+int Scheduler::account_run(Process* process, int start, int duration) {
+    if (!process->has_started) {
+        process->start_time = start;
+        process->has_started = true;
+    }
+    
+    // Update process timing (a slice never crosses the end of a CPU burst)
+    int actual_duration = std::min(duration, process->burst_left);
+    process->remaining_time -= actual_duration;
+    process->burst_left -= actual_duration;
+    process->last_run_time = start;
     
     // Set completion time if process is done
     if (process->is_complete()) {
-        process->completion_time = current_time;
+        process->completion_time = start + actual_duration;
         process->calculate_metrics();
+        remaining_jobs--;
+    } else if (process->burst_left == 0) {
+        start_io(process, start + actual_duration);
     }
+    return actual_duration;
+}
+
+void Scheduler::start_io(Process* process, int time) {
+    const size_t slot = static_cast<size_t>(process - processes.data());
+    const int wake = time + BurstTable::burst(process->bursts_id, process->burst_index + 1);
+    process->burst_index += 2;
+    process->burst_left = BurstTable::burst(process->bursts_id, process->burst_index);
+    process->blocked = true;
+    
+    io_wakeups.push(wake, slot);
+    gantt_sink->record_io(process->pid, time, wake);
 }
 
 void Scheduler::add_to_gantt(int pid, int start_time, int end_time) {
-    gantt.add_entry(pid, start_time, end_time);
+    gantt_sink->record(pid, start_time, end_time);
 }
 
 bool Scheduler::all_processes_complete() const {
-    for (const auto& process : processes) {
-        if (!process.is_complete()) {
-            return false;
-        }
-    }
-    return true;
+    return remaining_jobs == 0;
 }
 
 std::vector<Process*> Scheduler::get_ready_processes(int time) {
     std::vector<Process*> ready;
     for (auto& process : processes) {
-        if (process.arrival_time <= time && !process.is_complete()) {
+        if (process.arrival_time <= time && process.is_runnable()) {
             ready.push_back(&process);
         }
     }
@@ -131,19 +231,65 @@ std::vector<Process*> Scheduler::get_ready_processes(int time) {
 }
 
 Process* Scheduler::find_process_by_pid(int pid) {
-    for (auto& process : processes) {
-        if (process.pid == pid) {
-            return &process;
+    if (dense_pid_index) {
+        if (pid < 0 || pid >= static_cast<int>(pid_slots.size())) return nullptr;
+        int slot = pid_slots[pid];
+        return slot < 0 ? nullptr : &processes[slot];
+    }
+    
+    auto it = sparse_pid_slots.find(pid);
+    return it == sparse_pid_slots.end() ? nullptr : &processes[it->second];
+}
+
+void Scheduler::reindex_processes() {
+    rebuild_pid_index();
+    off_cpu_since.assign(processes.size(), -1);
+}
+
+void Scheduler::recount_remaining_jobs() {
+    remaining_jobs = 0;
+    for (const auto& process : processes) {
+        if (!process.is_complete()) {
+            remaining_jobs++;
+        }
+    }
+}
+
+void Scheduler::rebuild_pid_index() {
+    pid_slots.clear();
+    sparse_pid_slots.clear();
+    
+    int min_pid = 0;
+    int max_pid = -1;
+    for (const auto& process : processes) {
+        min_pid = std::min(min_pid, process.pid);
+        max_pid = std::max(max_pid, process.pid);
+    }
+    
+    // Dense only when the array stays within a small factor of the process count
+    const long long dense_limit = 2LL * static_cast<long long>(processes.size()) + 64;
+    dense_pid_index = min_pid >= 0 && max_pid < dense_limit;
+    
+    // On duplicate PIDs the first occurrence wins, as with a linear scan
+    if (dense_pid_index) {
+        pid_slots.assign(max_pid + 1, -1);
+        for (size_t i = 0; i < processes.size(); i++) {
+            int& slot = pid_slots[processes[i].pid];
+            if (slot < 0) slot = static_cast<int>(i);
+        }
+    } else {
+        sparse_pid_slots.reserve(processes.size());
+        for (size_t i = 0; i < processes.size(); i++) {
+            sparse_pid_slots.insert(std::make_pair(processes[i].pid, static_cast<int>(i)));
         }
     }
-    return nullptr;
 }
 
 void Scheduler::advance_time(int new_time) {
     if (new_time > current_time) {
         // Add idle time if there's a gap
         if (current_time < new_time) {
-            gantt.add_idle(current_time, new_time);
+            gantt_sink->record(-1, current_time, new_time);  // -1 represents idle time
         }
         current_time = new_time;
     }
@@ -157,6 +303,7 @@ void Scheduler::sort_by_arrival_time() {
                   }
                   return a.pid < b.pid;  // Tie breaking
               });
+    reindex_processes();
 }
 
 void Scheduler::sort_by_burst_time() {
@@ -167,6 +314,7 @@ void Scheduler::sort_by_burst_time() {
                   }
                   return a.pid < b.pid;  // Tie breaking
               });
+    reindex_processes();
 }
 
 void Scheduler::sort_by_priority() {
@@ -177,6 +325,7 @@ void Scheduler::sort_by_priority() {
                   }
                   return a.pid < b.pid;  // Tie breaking
               });
+    reindex_processes();
 }
 
 void Scheduler::sort_by_remaining_time() {
@@ -187,6 +336,204 @@ void Scheduler::sort_by_remaining_time() {
                   }
                   return a.pid < b.pid;  // Tie breaking
               });
+    reindex_processes();
+}
+
+void IoWakeupQueue::push(int time, size_t slot) {
+    events.push(std::make_pair(time, slot));
+}
+
+bool IoWakeupQueue::empty() const {
+    return events.empty();
+}
+
+size_t IoWakeupQueue::size() const {
+    return events.size();
+}
+
+int IoWakeupQueue::next_time() const {
+    return events.empty() ? -1 : events.top().first;
+}
+
+size_t IoWakeupQueue::pop() {
+    size_t slot = events.top().second;
+    events.pop();
+    return slot;
+}
+
+void IoWakeupQueue::clear() {
+    events = std::priority_queue<Event, std::vector<Event>, std::greater<Event> >();
+}
+
+ArrivalCursor::ArrivalCursor() : source(nullptr), next(0), wakeups(nullptr) {}
+
+void ArrivalCursor::attach(std::vector<Process>& arrival_sorted, IoWakeupQueue* io) {
+    source = &arrival_sorted;
+    next = 0;
+    wakeups = io;
+}
+
+bool ArrivalCursor::has_pending() const {
+    return (source && next < source->size()) || (wakeups && !wakeups->empty());
+}
+
+int ArrivalCursor::next_arrival_time() const {
+    int time = source && next < source->size() ? (*source)[next].arrival_time : -1;
+    if (wakeups && !wakeups->empty() && (time < 0 || wakeups->next_time() < time)) {
+        time = wakeups->next_time();
+    }
+    return time;
+}
+
+Process* ArrivalCursor::pop_arrived(int time) {
+    if (source && next < source->size() && (*source)[next].arrival_time <= time) {
+        return &(*source)[next++];
+    }
+    if (wakeups && !wakeups->empty() && wakeups->next_time() <= time) {
+        const int woke = wakeups->next_time();
+        Process* process = &(*source)[wakeups->pop()];
+        process->ready_time = woke;
+        process->blocked = false;
+        return process;
+    }
+    return nullptr;
+}
+
+ReadyQueue::ReadyQueue(ReadyOrder order)
+    : order(order), ring_head(0), ring_size(0) {}
+
+void ReadyQueue::attach(std::vector<Process>& arrival_sorted, IoWakeupQueue* wakeups) {
+    clear();
+    arrivals.attach(arrival_sorted, wakeups);
+    
+    // Reserve up front so steady-state scheduling never reallocates
+    if (order == ReadyOrder::FIFO) {
+        ring.assign(arrival_sorted.size() > 0 ? arrival_sorted.size() : 1, nullptr);
+    } else {
+        heap.reserve(arrival_sorted.size());
+    }
+}
+
+void ReadyQueue::admit_arrivals(int time) {
+    while (Process* process = arrivals.pop_arrived(time)) {
+        if (!process->is_complete()) {
+            push(process);
+        }
+    }
+}
+
+bool ReadyQueue::has_pending_arrivals() const {
+    return arrivals.has_pending();
+}
+
+int ReadyQueue::next_arrival_time() const {
+    return arrivals.next_arrival_time();
+}
+
+void ReadyQueue::push(Process* process) {
+    if (order != ReadyOrder::FIFO) {
+        heap.push_back(process);
+        std::push_heap(heap.begin(), heap.end(),
+                       [this](const Process* a, const Process* b) { return heap_less(a, b); });
+        return;
+    }
+    
+    if (ring_size == ring.size()) {
+        // Grow the ring, unwrapping it so the head lands at index 0
+        std::vector<Process*> grown(ring.empty() ? 16 : ring.size() * 2, nullptr);
+        for (size_t i = 0; i < ring_size; i++) {
+            grown[i] = ring[(ring_head + i) % ring.size()];
+        }
+        ring.swap(grown);
+        ring_head = 0;
+    }
+    ring[(ring_head + ring_size) % ring.size()] = process;
+    ring_size++;
+}
+
+Process* ReadyQueue::pop() {
+    if (empty()) return nullptr;
+    
+    if (order != ReadyOrder::FIFO) {
+        std::pop_heap(heap.begin(), heap.end(),
+                      [this](const Process* a, const Process* b) { return heap_less(a, b); });
+        Process* process = heap.back();
+        heap.pop_back();
+        return process;
+    }
+    
+    Process* process = ring[ring_head];
+    ring_head = (ring_head + 1) % ring.size();
+    ring_size--;
+    return process;
+}
+
+Process* ReadyQueue::steal() {
+    if (empty()) return nullptr;
+    
+    if (order != ReadyOrder::FIFO) {
+        // Removing the last leaf keeps the heap property intact
+        Process* process = heap.back();
+        heap.pop_back();
+        return process;
+    }
+    
+    ring_size--;
+    return ring[(ring_head + ring_size) % ring.size()];
+}
+
+Process* ReadyQueue::top() const {
+    if (empty()) return nullptr;
+    return order == ReadyOrder::FIFO ? ring[ring_head] : heap.front();
+}
+
+bool ReadyQueue::empty() const {
+    return size() == 0;
+}
+
+size_t ReadyQueue::size() const {
+    return order == ReadyOrder::FIFO ? ring_size : heap.size();
+}
+
+void ReadyQueue::clear() {
+    ring_head = 0;
+    ring_size = 0;
+    heap.clear();
+}
+
+bool ReadyQueue::runs_before(const Process* a, const Process* b) const {
+    switch (order) {
+        case ReadyOrder::SHORTEST_BURST:
+            if (a->burst_time != b->burst_time) return a->burst_time < b->burst_time;
+            break;
+        case ReadyOrder::SHORTEST_REMAINING:
+            if (a->remaining_time != b->remaining_time) return a->remaining_time < b->remaining_time;
+            break;
+        case ReadyOrder::PRIORITY:
+            if (a->priority != b->priority) return a->priority < b->priority;
+            if (a->arrival_time != b->arrival_time) return a->arrival_time < b->arrival_time;
+            break;
+        case ReadyOrder::EARLIEST_DEADLINE:
+            // As unsigned, "no deadline" (-1) sorts after every real deadline
+            if (a->deadline != b->deadline) {
+                return static_cast<unsigned>(a->deadline) < static_cast<unsigned>(b->deadline);
+            }
+            if (a->arrival_time != b->arrival_time) return a->arrival_time < b->arrival_time;
+            break;
+        case ReadyOrder::FIFO:
+            if (a->arrival_time != b->arrival_time) return a->arrival_time < b->arrival_time;
+            break;
+    }
+    return a->pid < b->pid;  // Tie breaking
+}
+
+ReadyOrder ReadyQueue::get_order() const {
+    return order;
+}
+
+bool ReadyQueue::heap_less(const Process* a, const Process* b) const {
+    // std::*_heap builds a max-heap, so "less" means "runs later"
+    return runs_before(b, a);
 }
 
 // Forward declarations are no longer needed since we include the implementations above
@@ -200,7 +547,81 @@ Scheduler* create_scheduler(const std::string& algorithm) {
         return new STCFScheduler();
     } else if (algorithm == "rr") {
         return new RoundRobinScheduler();
+    } else if (algorithm == "priority") {
+        return new PriorityScheduler(false);
+    } else if (algorithm == "priority-preemptive" || algorithm == "ppriority") {
+        return new PriorityScheduler(true);
+    } else if (algorithm == "mlfq") {
+        return new MLFQScheduler();
+    } else if (algorithm == "cfs") {
+        return new CFSScheduler();
+    } else if (algorithm == "lottery") {
+        return new LotteryScheduler();
+    } else if (algorithm == "stride") {
+        return new StrideScheduler();
+    } else if (algorithm == "edf") {
+        return new EDFScheduler(true);
+    } else if (algorithm == "edf-np") {
+        return new EDFScheduler(false);
     } else {
         throw std::runtime_error("Unknown scheduling algorithm: " + algorithm);
     }
 }
+
+const std::vector<std::string>& scheduler_names() {
+    static const std::vector<std::string> names = {
+        "fcfs", "sjf", "stcf", "rr", "priority", "priority-preemptive",
+        "mlfq", "cfs", "lottery", "stride", "edf", "edf-np"
+    };
+    return names;
+}
+
+Scheduler* create_round_robin_scheduler(int time_quantum) {
+    if (time_quantum <= 0) {
+        throw std::runtime_error("Time quantum must be positive");
+    }
+    return new RoundRobinScheduler(time_quantum);
+}
+
+Scheduler* create_priority_scheduler(bool preemptive, int aging_interval) {
+    if (aging_interval < 0) {
+        throw std::runtime_error("Aging interval must not be negative");
+    }
+    return new PriorityScheduler(preemptive, aging_interval);
+}
+
+Scheduler* create_mlfq_scheduler(const std::vector<int>& quanta, int boost_period) {
+    if (quanta.empty() || quanta.size() > static_cast<size_t>(MLFQScheduler::MAX_LEVELS)) {
+        throw std::runtime_error("MLFQ needs between 1 and 64 levels");
+    }
+    for (int quantum : quanta) {
+        if (quantum <= 0) {
+            throw std::runtime_error("Time quantum must be positive");
+        }
+    }
+    if (boost_period < 0) {
+        boost_period = MLFQScheduler::DEFAULT_BOOST_PERIOD;
+    }
+    return new MLFQScheduler(quanta, boost_period);
+}
+
+Scheduler* create_cfs_scheduler(int target_latency, int min_granularity) {
+    if (target_latency <= 0 || min_granularity <= 0) {
+        throw std::runtime_error("CFS target latency and minimum granularity must be positive");
+    }
+    return new CFSScheduler(target_latency, min_granularity);
+}
+
+Scheduler* create_lottery_scheduler(int time_quantum, uint64_t seed) {
+    if (time_quantum <= 0) {
+        throw std::runtime_error("Time quantum must be positive");
+    }
+    return new LotteryScheduler(time_quantum, seed);
+}
+
+Scheduler* create_stride_scheduler(int time_quantum) {
+    if (time_quantum <= 0) {
+        throw std::runtime_error("Time quantum must be positive");
+    }
+    return new StrideScheduler(time_quantum);
+}
@@ -0,0 +1,306 @@
+#include "smp.h"
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+SMPScheduler::SMPScheduler(const std::string& algorithm, int cpu_count, DispatchMode mode, int quantum)
+    : Scheduler(""), order(ReadyOrder::FIFO), preemptive(false), time_quantum(0), mode(mode),
+      steal_policy(StealPolicy::NONE), steal_seed(1), steals(0), migrations(0) {
+    if (cpu_count <= 0) {
+        throw std::runtime_error("CPU count must be positive");
+    }
+    if (quantum < 0) {
+        throw std::runtime_error("Time quantum must be positive");
+    }
+    
+    std::string name;
+    if (algorithm == "fcfs" || algorithm == "fifo") {
+        name = "First Come First Serve (FCFS)";
+    } else if (algorithm == "sjf") {
+        name = "Shortest Job First (SJF)";
+        order = ReadyOrder::SHORTEST_BURST;
+    } else if (algorithm == "stcf" || algorithm == "srtf") {
+        name = "Shortest Time to Completion First (STCF)";
+        order = ReadyOrder::SHORTEST_REMAINING;
+        preemptive = true;
+    } else if (algorithm == "edf") {
+        name = "Earliest Deadline First (EDF)";
+        order = ReadyOrder::EARLIEST_DEADLINE;
+        preemptive = true;
+    } else if (algorithm == "rr") {
+        name = "Round Robin (RR)";
+        time_quantum = quantum > 0 ? quantum : 2;
+    } else {
+        throw std::runtime_error("Unknown scheduling algorithm: " + algorithm);
+    }
+    
+    algorithm_name = name + " on " + std::to_string(cpu_count) +
+                     (cpu_count == 1 ? " CPU" : " CPUs") +
+                     (mode == DispatchMode::GLOBAL ? " (global queue)" : " (per-CPU queues)");
+    cpus.resize(cpu_count);
+}
+
+void SMPScheduler::schedule() {
+    sort_by_arrival_time();
+    
+    const size_t cpu_count = cpus.size();
+    cpus.assign(cpu_count, CPU());
+    queues.assign(mode == DispatchMode::GLOBAL ? 1 : cpu_count, ReadyQueue(order));
+    last_cpu.assign(processes.size(), -1);
+    steal_rng.seed(steal_seed);
+    steals = 0;
+    migrations = 0;
+    cpu_gantts.assign(cpu_count, GanttChart());
+    for (auto& chart : cpu_gantts) {
+        chart.set_compact(gantt.is_compact());
+    }
+    
+    ArrivalCursor arrivals;
+    arrivals.attach(processes, &io_wakeups);
+    
+    int now = current_time;
+    for (auto& cpu : cpus) {
+        cpu.free_since = now;
+    }
+    
+    std::vector<std::pair<Process*, size_t> > expired;
+    while (true) {
+        // 1. Charge running jobs up to now and free CPUs whose slice ended
+        expired.clear();
+        for (size_t c = 0; c < cpu_count; c++) {
+            CPU& cpu = cpus[c];
+            if (!cpu.running) continue;
+            account_until(c, now);
+            if (cpu.running->is_complete() || cpu.slice_end <= now) {
+                if (cpu.running->is_runnable()) {
+                    expired.push_back(std::make_pair(cpu.running, c));
+                }
+                cpu.running = nullptr;
+                cpu.free_since = now;
+            }
+        }
+        
+        // 2. Admit arrivals before requeueing expired slices (as in single-CPU RR)
+        while (Process* process = arrivals.pop_arrived(now)) {
+            if (!process->is_complete()) {
+                enqueue(process, least_loaded_cpu());
+            }
+        }
+        for (const auto& entry : expired) {
+            enqueue(entry.first, entry.second);
+        }
+        
+        // 3. Dispatch idle CPUs from their own queue, let the ones still idle
+        //    steal, then let better waiting jobs preempt
+        for (size_t c = 0; c < cpu_count; c++) {
+            ReadyQueue& queue = queue_for(c);
+            if (!cpus[c].running && !queue.empty()) {
+                dispatch(c, queue.pop(), now);
+            }
+        }
+        if (mode == DispatchMode::PER_CPU && steal_policy != StealPolicy::NONE) {
+            for (size_t c = 0; c < cpu_count; c++) {
+                if (cpus[c].running) continue;
+                if (Process* stolen = steal_for(c)) {
+                    dispatch(c, stolen, now);
+                }
+            }
+        }
+        if (preemptive) {
+            preempt(now);
+        }
+        
+        // 4. Jump to the next arrival or slice end
+        if (all_processes_complete()) break;
+        int next = next_event(arrivals.next_arrival_time());
+        if (next < 0) break;
+        now = next;
+    }
+    
+    // Every timeline runs to the makespan, idle after its last slice
+    current_time = now;
+    for (size_t c = 0; c < cpu_count; c++) {
+        if (cpus[c].free_since < now) {
+            cpu_gantts[c].record(-1, cpus[c].free_since, now);
+        }
+    }
+}
+
+ReadyQueue& SMPScheduler::queue_for(size_t cpu) {
+    return mode == DispatchMode::GLOBAL ? queues[0] : queues[cpu];
+}
+
+void SMPScheduler::enqueue(Process* process, size_t cpu) {
+    queue_for(cpu).push(process);
+}
+
+size_t SMPScheduler::least_loaded_cpu() const {
+    if (mode == DispatchMode::GLOBAL) return 0;
+    
+    size_t best = 0;
+    size_t best_load = 0;
+    for (size_t c = 0; c < cpus.size(); c++) {
+        size_t load = queues[c].size() + (cpus[c].running ? 1 : 0);
+        if (c == 0 || load < best_load) {
+            best = c;
+            best_load = load;
+        }
+    }
+    return best;
+}
+
+Process* SMPScheduler::steal_for(size_t thief) {
+    size_t victim = cpus.size();
+    
+    if (steal_policy == StealPolicy::BUSIEST) {
+        for (size_t c = 0; c < cpus.size(); c++) {
+            if (c != thief && !queues[c].empty() &&
+                (victim == cpus.size() || queues[c].size() > queues[victim].size())) {
+                victim = c;
+            }
+        }
+    } else if (steal_policy == StealPolicy::RANDOM) {
+        // Uniform over the non-empty queues, without building a candidate list
+        size_t candidates = 0;
+        for (size_t c = 0; c < cpus.size(); c++) {
+            if (c != thief && !queues[c].empty()) candidates++;
+        }
+        if (candidates > 0) {
+            size_t pick = static_cast<size_t>(steal_rng() % candidates);
+            for (size_t c = 0; c < cpus.size(); c++) {
+                if (c != thief && !queues[c].empty() && pick-- == 0) {
+                    victim = c;
+                    break;
+                }
+            }
+        }
+    }
+    
+    if (victim == cpus.size()) return nullptr;
+    steals++;
+    return queues[victim].steal();
+}
+
+void SMPScheduler::account_until(size_t cpu, int now) {
+    CPU& state = cpus[cpu];
+    if (!state.running || now <= state.slice_start) return;
+    
+    int used = account_run(state.running, state.slice_start, now - state.slice_start);
+    cpu_gantts[cpu].record(state.running->pid, state.slice_start, state.slice_start + used);
+    state.slice_start += used;
+}
+
+void SMPScheduler::dispatch(size_t cpu, Process* process, int now) {
+    CPU& state = cpus[cpu];
+    if (state.free_since < now) {
+        cpu_gantts[cpu].record(-1, state.free_since, now);
+    }
+    
+    int slice = process->burst_left;
+    if (time_quantum > 0) {
+        slice = std::min(slice, time_quantum);
+    }
+    
+    state.running = process;
+    state.slice_start = now;
+    state.slice_end = now + slice;
+    
+    int& last = last_cpu[process - processes.data()];
+    if (last >= 0 && last != static_cast<int>(cpu)) {
+        migrations++;
+    }
+    last = static_cast<int>(cpu);
+}
+
+void SMPScheduler::preempt(int now) {
+    // Running jobs are fully accounted up to `now`, so their remaining times
+    // are current and comparable with the waiting ones
+    if (mode == DispatchMode::PER_CPU) {
+        for (size_t c = 0; c < cpus.size(); c++) {
+            ReadyQueue& queue = queues[c];
+            Process* running = cpus[c].running;
+            if (running && !queue.empty() && queue.runs_before(queue.top(), running)) {
+                queue.push(running);
+                cpus[c].running = nullptr;
+                cpus[c].free_since = now;
+                dispatch(c, queue.pop(), now);
+            }
+        }
+        return;
+    }
+    
+    // Global queue: the best waiting job replaces the worst running one
+    ReadyQueue& queue = queues[0];
+    while (!queue.empty()) {
+        size_t victim = cpus.size();
+        for (size_t c = 0; c < cpus.size(); c++) {
+            if (cpus[c].running &&
+                (victim == cpus.size() || queue.runs_before(cpus[victim].running, cpus[c].running))) {
+                victim = c;
+            }
+        }
+        if (victim == cpus.size() || !queue.runs_before(queue.top(), cpus[victim].running)) break;
+        
+        queue.push(cpus[victim].running);
+        cpus[victim].running = nullptr;
+        cpus[victim].free_since = now;
+        dispatch(victim, queue.pop(), now);
+    }
+}
+
+int SMPScheduler::next_event(int next_arrival) const {
+    int next = next_arrival;
+    for (const auto& cpu : cpus) {
+        if (cpu.running && (next < 0 || cpu.slice_end < next)) {
+            next = cpu.slice_end;
+        }
+    }
+    return next;
+}
+
+void SMPScheduler::set_steal_policy(StealPolicy policy, uint64_t seed) {
+    steal_policy = policy;
+    steal_seed = seed;
+}
+
+int SMPScheduler::get_cpu_count() const {
+    return static_cast<int>(cpus.size());
+}
+
+DispatchMode SMPScheduler::get_dispatch_mode() const {
+    return mode;
+}
+
+StealPolicy SMPScheduler::get_steal_policy() const {
+    return steal_policy;
+}
+
+const std::vector<GanttChart>& SMPScheduler::get_cpu_gantt_charts() const {
+    return cpu_gantts;
+}
+
+long long SMPScheduler::get_steal_count() const {
+    return steals;
+}
+
+long long SMPScheduler::get_migration_count() const {
+    return migrations;
+}
+
+void SMPScheduler::print_cpu_gantt_charts() const {
+    for (size_t c = 0; c < cpu_gantts.size(); c++) {
+        std::cout << "\nCPU " << c << ":";
+        cpu_gantts[c].print();
+    }
+}
+
+void SMPScheduler::print_smp_stats() const {
+    std::cout << "=== SMP Statistics ===\n";
+    std::cout << "Steals:          " << steals << "\n";
+    std::cout << "Migrations:      " << migrations << "\n\n";
+}
+
+SMPScheduler* create_smp_scheduler(const std::string& algorithm, int cpus,
+                                   DispatchMode mode, int time_quantum) {
+    return new SMPScheduler(algorithm, cpus, mode, time_quantum);
+}
@@ -0,0 +1,288 @@
+#include "workload_generator.h"
+#include "binary_workload.h"
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+
+// Split on a delimiter, keeping empty fields
+std::vector<std::string> split(const std::string& text, char delimiter) {
+    std::vector<std::string> fields;
+    std::string field;
+    std::istringstream stream(text);
+    while (std::getline(stream, field, delimiter)) {
+        fields.push_back(field);
+    }
+    if (!text.empty() && text[text.size() - 1] == delimiter) {
+        fields.push_back("");
+    }
+    return fields;
+}
+
+double parse_number(const std::string& field, const std::string& context) {
+    const char* begin = field.c_str();
+    char* end = nullptr;
+    double value = std::strtod(begin, &end);
+    if (field.empty() || *end != '\0' || !std::isfinite(value)) {
+        throw std::runtime_error("Invalid number '" + field + "' in " + context);
+    }
+    return value;
+}
+
+// Append an int in decimal without going through iostreams
+void append_int(std::string& out, int value) {
+    char digits[12];
+    int n = 0;
+    unsigned int magnitude = value < 0 ? 0u - static_cast<unsigned int>(value)
+                                       : static_cast<unsigned int>(value);
+    do {
+        digits[n++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) out.push_back('-');
+    while (n > 0) out.push_back(digits[--n]);
+}
+
+} // namespace
+
+WorkloadSpec::WorkloadSpec()
+    : count(1000), seed(1), arrival_rate(0.5),
+      burst(BurstDistribution::EXPONENTIAL), burst_mean(10.0),
+      short_mean(2.0), long_mean(50.0), long_fraction(0.2),
+      pareto_alpha(1.5), pareto_min(1.0), max_burst(1000000),
+      first_pid(1) {
+    for (int p = 1; p <= 5; p++) {
+        priority_mix.push_back(std::make_pair(p, 1.0));
+    }
+}
+
+void WorkloadSpec::set_burst(const std::string& text) {
+    std::vector<std::string> fields = split(text, ':');
+    const std::string context = "burst spec '" + text + "'";
+    const std::string kind = fields.empty() ? std::string() : fields[0];
+    
+    if (kind == "exp" && fields.size() == 2) {
+        burst = BurstDistribution::EXPONENTIAL;
+        burst_mean = parse_number(fields[1], context);
+    } else if (kind == "bimodal" && fields.size() == 4) {
+        burst = BurstDistribution::BIMODAL;
+        short_mean = parse_number(fields[1], context);
+        long_mean = parse_number(fields[2], context);
+        long_fraction = parse_number(fields[3], context);
+    } else if (kind == "pareto" && fields.size() == 3) {
+        burst = BurstDistribution::PARETO;
+        pareto_alpha = parse_number(fields[1], context);
+        pareto_min = parse_number(fields[2], context);
+    } else {
+        throw std::runtime_error("Invalid " + context +
+                                 " (expected exp:MEAN, bimodal:SHORT:LONG:FRACTION or pareto:ALPHA:MIN)");
+    }
+}
+
+void WorkloadSpec::set_priority_mix(const std::string& text) {
+    const std::string context = "priority mix '" + text + "'";
+    std::vector<std::pair<int, double>> mix;
+    
+    for (const std::string& entry : split(text, ',')) {
+        std::vector<std::string> fields = split(entry, ':');
+        if (fields.size() != 2) {
+            throw std::runtime_error("Invalid " + context + " (expected PRIO:WEIGHT,...)");
+        }
+        double priority = parse_number(fields[0], context);
+        if (priority != std::floor(priority) || std::fabs(priority) > INT_MAX) {
+            throw std::runtime_error("Priority must be an integer in " + context);
+        }
+        mix.push_back(std::make_pair(static_cast<int>(priority), parse_number(fields[1], context)));
+    }
+    priority_mix.swap(mix);
+}
+
+void WorkloadSpec::validate() const {
+    if (!(arrival_rate > 0.0)) {
+        throw std::runtime_error("Arrival rate must be positive");
+    }
+    if (max_burst <= 0) {
+        throw std::runtime_error("Maximum burst must be positive");
+    }
+    switch (burst) {
+        case BurstDistribution::EXPONENTIAL:
+            if (!(burst_mean > 0.0)) throw std::runtime_error("Burst mean must be positive");
+            break;
+        case BurstDistribution::BIMODAL:
+            if (!(short_mean > 0.0) || !(long_mean > 0.0)) {
+                throw std::runtime_error("Bimodal burst means must be positive");
+            }
+            if (long_fraction < 0.0 || long_fraction > 1.0) {
+                throw std::runtime_error("Bimodal long fraction must be in [0, 1]");
+            }
+            break;
+        case BurstDistribution::PARETO:
+            if (!(pareto_alpha > 0.0) || !(pareto_min > 0.0)) {
+                throw std::runtime_error("Pareto alpha and minimum must be positive");
+            }
+            break;
+    }
+    
+    double total_weight = 0.0;
+    for (const auto& entry : priority_mix) {
+        if (entry.second < 0.0) throw std::runtime_error("Priority weights must not be negative");
+        total_weight += entry.second;
+    }
+    if (!(total_weight > 0.0)) {
+        throw std::runtime_error("Priority mix needs at least one positive weight");
+    }
+    if (first_pid < 0 || static_cast<unsigned long long>(first_pid) + count > static_cast<unsigned long long>(INT_MAX) + 1) {
+        throw std::runtime_error("Process count does not fit in int PIDs");
+    }
+}
+
+WorkloadGenerator::WorkloadGenerator(const WorkloadSpec& workload)
+    : spec(workload), rng(workload.seed), clock(0.0), produced(0) {
+    spec.validate();
+    
+    // Cumulative weights, normalized so the last entry is exactly 1
+    double total = 0.0;
+    for (const auto& entry : spec.priority_mix) {
+        total += entry.second;
+        priority_cdf.push_back(total);
+    }
+    for (double& c : priority_cdf) {
+        c /= total;
+    }
+    priority_cdf.back() = 1.0;
+}
+
+double WorkloadGenerator::uniform() {
+    return static_cast<double>(rng() >> 11) * (1.0 / 9007199254740992.0);  // 2^-53
+}
+
+double WorkloadGenerator::exponential(double mean) {
+    // Inverse CDF; 1 - U lies in (0, 1], so the log is finite
+    return -mean * std::log(1.0 - uniform());
+}
+
+int WorkloadGenerator::sample_burst() {
+    double value = 0.0;
+    switch (spec.burst) {
+        case BurstDistribution::EXPONENTIAL:
+            value = exponential(spec.burst_mean);
+            break;
+        case BurstDistribution::BIMODAL: {
+            bool is_long = uniform() < spec.long_fraction;
+            value = exponential(is_long ? spec.long_mean : spec.short_mean);
+            break;
+        }
+        case BurstDistribution::PARETO:
+            value = spec.pareto_min / std::pow(1.0 - uniform(), 1.0 / spec.pareto_alpha);
+            break;
+    }
+    
+    // Round to whole time units, clamped before converting to avoid overflow
+    value = std::floor(value + 0.5);
+    if (value < 1.0) return 1;
+    if (value > spec.max_burst) return spec.max_burst;
+    return static_cast<int>(value);
+}
+
+int WorkloadGenerator::sample_priority() {
+    double u = uniform();
+    size_t index = std::upper_bound(priority_cdf.begin(), priority_cdf.end(), u) - priority_cdf.begin();
+    return spec.priority_mix[std::min(index, priority_cdf.size() - 1)].first;
+}
+
+Process WorkloadGenerator::next() {
+    if (done()) {
+        throw std::runtime_error("Workload generator exhausted");
+    }
+    
+    // The first process arrives at time 0; the rest follow a Poisson process
+    if (produced > 0) {
+        clock += exponential(1.0 / spec.arrival_rate);
+    }
+    if (clock >= static_cast<double>(INT_MAX)) {
+        throw std::runtime_error("Generated arrival times overflow int; increase the arrival rate");
+    }
+    
+    int pid = spec.first_pid + static_cast<int>(produced);
+    int arrival = static_cast<int>(clock);
+    int burst = sample_burst();
+    int priority = sample_priority();
+    produced++;
+    
+    return Process(pid, arrival, burst, priority);
+}
+
+std::vector<Process> WorkloadGenerator::generate() {
+    std::vector<Process> processes;
+    processes.reserve(spec.count - produced);
+    while (!done()) {
+        processes.push_back(next());
+    }
+    return processes;
+}
+
+ProcessTable WorkloadGenerator::generate_table() {
+    ProcessTable table;
+    table.reserve(spec.count - produced);
+    while (!done()) {
+        Process p = next();
+        table.add(p.pid, p.arrival_time, p.burst_time, p.priority);
+    }
+    return table;
+}
+
+size_t WorkloadGenerator::write_text(const WorkloadSpec& spec, std::ostream& out) {
+    WorkloadGenerator generator(spec);
+    
+    out << "# Generated workload: " << spec.count << " processes, seed " << spec.seed
+        << ", arrival rate " << spec.arrival_rate << "\n";
+    out << "# Format: PID Arrival_Time Burst_Time Priority\n";
+    
+    // Format into a local buffer and hand it over in large blocks
+    const size_t flush_threshold = 1 << 16;
+    std::string buffer;
+    buffer.reserve(flush_threshold + 64);
+    
+    while (!generator.done()) {
+        Process p = generator.next();
+        append_int(buffer, p.pid);
+        buffer.push_back(' ');
+        append_int(buffer, p.arrival_time);
+        buffer.push_back(' ');
+        append_int(buffer, p.burst_time);
+        buffer.push_back(' ');
+        append_int(buffer, p.priority);
+        buffer.push_back('\n');
+        
+        if (buffer.size() >= flush_threshold) {
+            out.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+    out.write(buffer.data(), buffer.size());
+    
+    if (!out) {
+        throw std::runtime_error("Failed to write generated workload");
+    }
+    return generator.generated();
+}
+
+size_t WorkloadGenerator::write_text(const WorkloadSpec& spec, const std::string& filename) {
+    std::ofstream file(filename.c_str(), std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot create file: " + filename);
+    }
+    return write_text(spec, file);
+}
+
+size_t WorkloadGenerator::write_binary(const WorkloadSpec& spec, const std::string& filename) {
+    WorkloadGenerator generator(spec);
+    ProcessTable table = generator.generate_table();
+    BinaryWorkload::save(filename, table);
+    return table.size();
+}
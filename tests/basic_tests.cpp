@@ -1,8 +1,26 @@
 #include "process.h"
 #include "file_parser.h"
 #include "gantt_chart.h"
+#include "scheduler.h"
+#include "performance.h"
+#include "gantt_sink.h"
+#include "process_table.h"
+#include "binary_workload.h"
+#include "experiment.h"
+#include "workload_generator.h"
+#include "smp.h"
+#include "indexed_heap.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <memory>
+#include <map>
+#include <algorithm>
 #include <iostream>
 #include <cassert>
+#include <cmath>
+#include <stdexcept>
 
 // Simple test framework
 int tests_passed = 0;
@@ -52,8 +70,12 @@ void test_process_creation() {
     
     Process p2(2, 3, 7, 1, "TestProcess");
     assert_equal(2, p2.pid, "Named process PID");
-    assert_equal("TestProcess", p2.name, "Process name");
+    assert_equal("TestProcess", p2.name(), "Process name");
     assert_equal(1, p2.priority, "Process priority");
+    assert_equal("P1", p1.name(), "Default process name");
+    
+    Process p3(3, 0, 1, 0, "TestProcess");
+    assert_equal((int)p2.name_id, (int)p3.name_id, "Equal names share one interned entry");
 }
 
 void test_process_metrics() {
@@ -81,7 +103,92 @@ void test_file_parser() {
     assert_equal(5, processes[0].burst_time, "First process burst");
     
     assert_equal(2, processes[1].priority, "Second process priority");
-    assert_equal("TestProc", processes[1].name, "Second process name");
+    assert_equal("TestProc", processes[1].name(), "Second process name");
+}
+
+void test_fast_parser() {
+    std::cout << "\n=== Testing Fast Parser ===\n";
+    
+    std::string test_data = "# header\n1 0 5\n  2  1  3  2  TestProc  extra\n\n3 x 4\n4 4 7 +1\r\n5 6 2";
+    std::vector<Process> slow = FileParser::parse_string(test_data);
+    
+    ParseStats stats;
+    std::vector<Process> fast = FileParser::parse_buffer(test_data.data(), test_data.size(), &stats);
+    
+    assert_equal((int)slow.size(), (int)fast.size(), "Fast parser process count");
+    assert_equal(7, (int)stats.lines, "Fast parser line count");
+    assert_equal(1, (int)stats.errors, "Fast parser rejects bad line");
+    assert_equal(slow[1].name(), fast[1].name(), "Fast parser name");
+    assert_equal(slow[2].priority, fast[2].priority, "Fast parser signed priority");
+    assert_equal(slow[3].burst_time, fast[3].burst_time, "Fast parser last line without newline");
+}
+
+void test_parallel_parser() {
+    std::cout << "\n=== Testing Parallel Parser ===\n";
+    
+    // Large enough (~4 MiB) to be split into several chunks
+    std::string test_data;
+    for (int i = 0; i < 300000; i++) {
+        test_data += (i == 150000 ? std::string("bad line") : std::to_string(i) + " 0 1 0 Name") + "\n";
+    }
+    
+    ParseStats stats;
+    std::vector<Process> procs = FileParser::parse_buffer_parallel(test_data.data(), test_data.size(), 4, &stats);
+    
+    bool in_order = true;
+    for (size_t i = 1; i < procs.size(); i++) {
+        if (procs[i].pid <= procs[i-1].pid) in_order = false;
+    }
+    assert_equal(true, stats.threads > 1, "Parallel parser used several chunks");
+    assert_equal(299999, (int)procs.size(), "Parallel parser process count");
+    assert_equal(300000, (int)stats.lines, "Parallel parser line count");
+    assert_equal(1, (int)stats.errors, "Parallel parser error count");
+    assert_equal(true, stats.diagnostics.size() == 1 && stats.diagnostics[0].line_number == 150001 &&
+                       stats.diagnostics[0].line == "bad line",
+                 "Parallel parser reports the error at its file line");
+    assert_equal(true, in_order, "Parallel parser keeps file order");
+}
+
+void test_binary_workload() {
+    std::cout << "\n=== Testing Binary Workload Format ===\n";
+    
+    const std::string path = "binary_workload_test.bin";
+    std::vector<Process> procs = FileParser::parse_string("1 0 5\n2 1 3 2 TestProc\n7 4 7 -1 Other");
+    BinaryWorkload::save(path, procs);
+    
+    assert_equal(true, BinaryWorkload::is_binary_file(path), "Binary magic detected");
+    std::vector<Process> loaded = BinaryWorkload::load(path);
+    std::remove(path.c_str());
+    
+    assert_equal(3, (int)loaded.size(), "Binary round trip count");
+    assert_equal(7, loaded[2].pid, "Binary round trip PID");
+    assert_equal(-1, loaded[2].priority, "Binary round trip priority");
+    assert_equal(7, loaded[2].remaining_time, "Binary load resets remaining time");
+    assert_equal("TestProc", loaded[1].name(), "Binary round trip name");
+    
+    // A burst of 0 patched into the file is rejected like in the text format
+    BinaryWorkload::save(path, FileParser::parse_string("1 0 123457"));
+    std::string bytes;
+    {
+        std::ifstream in(path.c_str(), std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    const char burst[4] = {'\x41', '\xe2', '\x01', '\x00'};  // 123457, little-endian
+    size_t at = bytes.find(std::string(burst, 4));
+    if (at != std::string::npos) bytes.replace(at, 4, std::string(4, '\0'));
+    {
+        std::ofstream out(path.c_str(), std::ios::binary);
+        out << bytes;
+    }
+    bool rejected = false;
+    try {
+        BinaryWorkload::load(path);
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    std::remove(path.c_str());
+    assert_equal(true, at != std::string::npos && rejected, "Binary load rejects a non-positive burst");
+    assert_equal("P1", loaded[0].name(), "Binary round trip default name");
 }
 
 void test_gantt_chart() {
@@ -103,13 +210,943 @@ void test_gantt_chart() {
     assert_equal(true, entries[2].is_idle(), "Third entry is idle");
 }
 
+void test_gantt_coalescing() {
+    std::cout << "\n=== Testing Gantt Coalescing and Compact Form ===\n";
+    
+    GanttChart gantt;
+    gantt.add_coalesced(1, 0, 1);
+    gantt.add_coalesced(1, 1, 2);   // same PID, touching: merged
+    gantt.add_coalesced(2, 2, 4);
+    gantt.add_coalesced(-1, 4, 5);
+    gantt.add_coalesced(-1, 5, 6);  // idle merges too
+    gantt.add_coalesced(2, 6, 300);
+    gantt.add_coalesced(1, 250, 400);  // overlap is kept, not merged
+    assert_equal(5, (int)gantt.size(), "Coalesced entry count");
+    assert_equal(2, gantt.get_entries()[0].end_time, "Merged entry end");
+    
+    GanttChart compact = gantt;
+    compact.set_compact(true);
+    assert_equal(true, compact.is_compact(), "Chart is compact");
+    assert_equal(gantt.get_total_time(), compact.get_total_time(), "Compact total time");
+    assert_equal(gantt.get_total_idle_time(), compact.get_total_idle_time(), "Compact idle time");
+    assert_equal(false, compact.is_valid(), "Compact chart detects overlap");
+    
+    compact.add_coalesced(1, 400, 410);
+    assert_equal(5, (int)compact.size(), "Compact tail still coalesces");
+    int checksum = 0;
+    for (const auto& entry : compact) {
+        checksum += entry.pid * entry.duration();
+    }
+    assert_equal(1*2 + 2*2 - 2 + 2*294 + 1*160, checksum, "Compact iteration");
+    
+    compact.set_compact(false);
+    assert_equal(250, compact.get_entries()[4].start_time, "Expanded again after compact");
+}
+
+void test_gantt_metrics_sink() {
+    std::cout << "\n=== Testing Online Gantt Metrics Sink ===\n";
+    
+    std::string test_data = "1 0 4\n2 1 2\n3 9 6\n4 10 3";
+    std::unique_ptr<Scheduler> in_memory(create_scheduler("rr"));
+    in_memory->load_processes(FileParser::parse_string(test_data));
+    in_memory->schedule();
+    GanttSummary expected = in_memory->get_gantt_chart().summarize();
+    
+    GanttMetricsSink sink;
+    std::unique_ptr<Scheduler> streamed(create_scheduler("rr"));
+    streamed->set_gantt_sink(&sink);
+    streamed->load_processes(FileParser::parse_string(test_data));
+    streamed->schedule();
+    
+    assert_equal(0, (int)streamed->get_gantt_chart().size(), "Sink bypasses in-memory chart");
+    assert_equal(expected.total_time, sink.summary().total_time, "Online makespan");
+    assert_equal(expected.idle_time, sink.summary().idle_time, "Online idle time");
+    assert_equal(expected.context_switches, sink.summary().context_switches, "Online context switches");
+    assert_equal((int)expected.slices, (int)sink.summary().slices, "Online slice count");
+}
+
+void test_process_table() {
+    std::cout << "\n=== Testing SoA Process Table ===\n";
+    
+    std::vector<Process> procs = FileParser::parse_string("5 0 4\n2 1 4\n9 2 1 3 Short\n1 8 2");
+    ProcessTable table(procs);
+    assert_equal(4, (int)table.size(), "Table size");
+    assert_equal(1, table.pid[2] == 9 && table.arrival_time[3] == 8 ? 1 : 0, "Columns in slot order");
+    
+    table.remaining_time[2] = 0;
+    std::vector<Process> back = table.to_processes();
+    assert_equal("Short", back[2].name(), "Round trip keeps names");
+    assert_equal(0, back[2].remaining_time, "Round trip keeps remaining time");
+}
+
+void test_stcf_scheduler() {
+    std::cout << "\n=== Testing STCF Scheduler ===\n";
+    
+    std::string test_data = "1 0 7\n2 2 4\n3 4 1\n4 5 3\n5 8 2\n6 10 5\n7 12 2";
+    std::unique_ptr<Scheduler> stcf(create_scheduler("stcf"));
+    stcf->load_processes(FileParser::parse_string(test_data));
+    assert_equal(7, stcf->remaining_count(), "STCF jobs remaining before run");
+    stcf->schedule();
+    assert_equal(0, stcf->remaining_count(), "STCF jobs remaining after run");
+    
+    const auto& procs = stcf->get_processes();
+    assert_equal(19, procs[0].completion_time, "STCF P1 completion (preempted twice)");
+    assert_equal(7, procs[1].completion_time, "STCF P2 completion");
+    assert_equal(24, procs[5].completion_time, "STCF P6 completion");
+    
+    PerformanceMetrics metrics(procs, stcf->get_gantt_chart());
+    assert_equal(8, metrics.calculate_context_switches(), "STCF context switches");
+    
+    PerformanceMetrics view = PerformanceMetrics::view(procs, stcf->get_gantt_chart());
+    assert_equal(metrics.calculate_average_waiting_time(), view.summary().average_waiting_time,
+                 "Metrics view matches owning metrics");
+    assert_equal(100.0, view.calculate_cpu_utilization(), "STCF CPU utilization");
+    assert_equal(true, stcf->get_gantt_chart().is_valid(), "STCF Gantt chart is contiguous");
+}
+
+void test_sparse_pids() {
+    std::cout << "\n=== Testing Sparse PID Lookup ===\n";
+    
+    // PIDs far apart force the hashed PID index
+    std::string test_data = "900000 0 3\n7 1 2\n42 2 1";
+    std::unique_ptr<Scheduler> rr(create_scheduler("rr"));
+    rr->load_processes(FileParser::parse_string(test_data));
+    rr->schedule();
+    
+    const auto& procs = rr->get_processes();
+    assert_equal(900000, procs[0].pid, "Sparse PID kept in arrival order");
+    assert_equal(6, procs[0].completion_time, "RR sparse P900000 completion");
+    assert_equal(4, procs[1].completion_time, "RR sparse P7 completion");
+    assert_equal(5, procs[2].completion_time, "RR sparse P42 completion");
+}
+
+void test_ready_queue() {
+    std::cout << "\n=== Testing Ready Queue ===\n";
+    
+    std::vector<Process> procs = FileParser::parse_string("1 0 5 2\n2 0 3 1\n3 4 1 1\n4 9 2 0");
+    
+    ReadyQueue by_priority(ReadyOrder::PRIORITY);
+    by_priority.attach(procs);
+    by_priority.admit_arrivals(4);
+    assert_equal(3, (int)by_priority.size(), "Arrivals admitted up to time 4");
+    assert_equal(9, by_priority.next_arrival_time(), "Next arrival time");
+    assert_equal(2, by_priority.pop()->pid, "Priority tie broken by arrival");
+    assert_equal(3, by_priority.pop()->pid, "Second highest priority");
+    assert_equal(1, by_priority.pop()->pid, "Lowest priority last");
+    
+    ReadyQueue fifo(ReadyOrder::FIFO);
+    fifo.attach(procs);
+    fifo.admit_arrivals(9);
+    fifo.push(fifo.pop());  // rotate like Round Robin
+    assert_equal(2, fifo.top()->pid, "FIFO rotation");
+    assert_equal(-1, fifo.next_arrival_time(), "No arrivals pending");
+}
+
+void test_compare_algorithms() {
+    std::cout << "\n=== Testing Algorithm Comparison ===\n";
+    
+    std::vector<Process> procs = FileParser::parse_string("1 0 8 1\n2 1 4 2\n3 2 9 1\n4 3 5 3");
+    std::vector<std::string> algorithms = {"sjf", "fcfs", "nope"};
+    std::vector<AlgorithmRun> runs = ExperimentRunner::compare_algorithms(procs, algorithms);
+    
+    assert_equal(3, (int)runs.size(), "One run per algorithm");
+    assert_equal(std::string("fcfs"), runs[1].algorithm, "Runs kept in input order");
+    assert_equal(8.75, runs[1].metrics.average_waiting_time, "FCFS avg waiting in comparison");
+    assert_equal(1, runs[2].error.empty() ? 0 : 1, "Unknown algorithm reported as error");
+    assert_equal(-1, procs[0].completion_time, "Shared input left untouched");
+}
+
+void test_quantum_sweep() {
+    std::cout << "\n=== Testing Quantum Sweep ===\n";
+    
+    std::vector<Process> procs = FileParser::parse_string("1 0 5\n2 1 3\n3 2 8\n4 3 6\n5 4 2");
+    std::vector<QuantumRun> runs = ExperimentRunner::sweep_round_robin(procs, 1, 9, 2, 3);
+    
+    assert_equal(5, (int)runs.size(), "One run per quantum in range");
+    assert_equal(7, runs[3].quantum, "Runs ordered by quantum");
+    
+    // Each sweep entry must match a standalone run with the same quantum
+    std::unique_ptr<Scheduler> rr(create_round_robin_scheduler(3));
+    rr->load_processes(procs);
+    rr->schedule();
+    PerformanceMetrics single(rr->get_processes(), rr->get_gantt_chart());
+    assert_equal(single.calculate_average_waiting_time(), runs[1].metrics.average_waiting_time,
+                 "Sweep matches standalone RR waiting time");
+    assert_equal(single.calculate_context_switches(), runs[1].metrics.context_switches,
+                 "Sweep matches standalone RR context switches");
+    
+    size_t best = ExperimentRunner::best_quantum(runs, SweepObjective::CONTEXT_SWITCHES);
+    assert_equal(9, runs[best].quantum, "Largest quantum minimizes switches");
+}
+
+void test_workload_generator() {
+    std::cout << "\n=== Testing Workload Generator ===\n";
+    
+    WorkloadSpec spec;
+    spec.count = 2000;
+    spec.seed = 42;
+    spec.set_burst("pareto:1.1:2");
+    spec.max_burst = 500;
+    spec.set_priority_mix("1:3,7:1");
+    
+    std::vector<Process> first = WorkloadGenerator(spec).generate();
+    std::vector<Process> second = WorkloadGenerator(spec).generate();
+    
+    bool same = first.size() == second.size();
+    bool ordered = true, bounded = true, mixed = true;
+    for (size_t i = 0; i < first.size(); i++) {
+        same = same && first[i].arrival_time == second[i].arrival_time &&
+               first[i].burst_time == second[i].burst_time && first[i].priority == second[i].priority;
+        ordered = ordered && (i == 0 || first[i].arrival_time >= first[i - 1].arrival_time);
+        bounded = bounded && first[i].burst_time >= 1 && first[i].burst_time <= 500;
+        mixed = mixed && (first[i].priority == 1 || first[i].priority == 7);
+    }
+    assert_equal(2000, (int)first.size(), "Generated process count");
+    assert_equal(1, same ? 1 : 0, "Same seed gives the same workload");
+    assert_equal(1, ordered ? 1 : 0, "Arrivals are non-decreasing");
+    assert_equal(1, bounded ? 1 : 0, "Bursts clamped to [1, max_burst]");
+    assert_equal(1, mixed ? 1 : 0, "Priorities drawn from the mix");
+    
+    // Text output must round-trip through the parser
+    std::ostringstream text;
+    spec.count = 50;
+    WorkloadGenerator::write_text(spec, text);
+    std::vector<Process> parsed = FileParser::parse_string(text.str());
+    assert_equal(50, (int)parsed.size(), "Generated text parses");
+    assert_equal(first[49].burst_time, parsed[49].burst_time, "Text output matches generator");
+    
+    bool rejected = false;
+    try {
+        spec.set_burst("");
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    assert_equal(true, rejected, "Empty burst spec rejected");
+}
+
+void test_smp_scheduler() {
+    std::cout << "\n=== Testing SMP Scheduler ===\n";
+    
+    std::string test_data = "1 0 7\n2 2 4\n3 4 1\n4 5 3\n5 8 2\n6 10 5\n7 12 2";
+    
+    // One CPU must reproduce the single-CPU scheduler exactly
+    std::unique_ptr<Scheduler> stcf(create_scheduler("stcf"));
+    stcf->load_processes(FileParser::parse_string(test_data));
+    stcf->schedule();
+    std::unique_ptr<SMPScheduler> one(create_smp_scheduler("stcf", 1));
+    one->load_processes(FileParser::parse_string(test_data));
+    one->schedule();
+    PerformanceMetrics single(stcf->get_processes(), stcf->get_gantt_chart());
+    PerformanceMetrics smp_single(one->get_processes(), one->get_cpu_gantt_charts());
+    assert_equal(single.calculate_average_waiting_time(), smp_single.calculate_average_waiting_time(),
+                 "1-CPU STCF matches single-CPU waiting time");
+    assert_equal(single.calculate_context_switches(), smp_single.calculate_context_switches(),
+                 "1-CPU STCF matches single-CPU context switches");
+    
+    // Two CPUs, global queue: P3 preempts P1 (the worse of the two running jobs)
+    std::unique_ptr<SMPScheduler> two(create_smp_scheduler("stcf", 2));
+    two->load_processes(FileParser::parse_string(test_data));
+    two->schedule();
+    PerformanceMetrics metrics(two->get_processes(), two->get_cpu_gantt_charts());
+    assert_equal(2, metrics.get_cpu_count(), "Metrics see two CPUs");
+    assert_equal(15, metrics.get_total_time(), "2-CPU STCF makespan");
+    assert_equal(2.0 / 7.0, metrics.calculate_average_waiting_time(), "2-CPU STCF avg waiting");
+    assert_equal(80.0, metrics.calculate_cpu_utilization(), "2-CPU combined utilization");
+    assert_equal(60.0, metrics.calculate_cpu_utilization(1), "CPU 1 utilization");
+    
+    // Invariants on a larger workload for every policy and dispatch mode
+    WorkloadSpec spec;
+    spec.count = 400;
+    spec.seed = 11;
+    spec.arrival_rate = 0.3;
+    std::vector<Process> workload = WorkloadGenerator(spec).generate();
+    long long total_burst = 0;
+    for (const auto& p : workload) total_burst += p.burst_time;
+    
+    const char* algorithms[] = {"fcfs", "sjf", "stcf", "rr"};
+    const DispatchMode modes[] = {DispatchMode::GLOBAL, DispatchMode::PER_CPU};
+    bool consistent = true;
+    for (const char* algorithm : algorithms) {
+        for (DispatchMode mode : modes) {
+            std::unique_ptr<SMPScheduler> smp(create_smp_scheduler(algorithm, 3, mode));
+            smp->load_processes(workload);
+            smp->schedule();
+            
+            // Charts are gap-free, busy time equals total burst, and no
+            // process runs on two CPUs at once
+            long long busy = 0;
+            std::map<int, std::vector<std::pair<int, int> > > runs;
+            for (const auto& chart : smp->get_cpu_gantt_charts()) {
+                consistent = consistent && chart.is_valid();
+                for (const auto& entry : chart) {
+                    if (entry.is_idle()) continue;
+                    busy += entry.duration();
+                    runs[entry.pid].push_back(std::make_pair(entry.start_time, entry.end_time));
+                }
+            }
+            for (auto& entry : runs) {
+                std::sort(entry.second.begin(), entry.second.end());
+                for (size_t i = 1; i < entry.second.size(); i++) {
+                    consistent = consistent && entry.second[i].first >= entry.second[i - 1].second;
+                }
+            }
+            consistent = consistent && busy == total_burst && smp->remaining_count() == 0;
+        }
+    }
+    assert_equal(1, consistent ? 1 : 0, "SMP timelines consistent for all policies and modes");
+}
+
+void test_work_stealing() {
+    std::cout << "\n=== Testing Work Stealing ===\n";
+    
+    // Stealing takes from the far end of the queue
+    std::vector<Process> procs = FileParser::parse_string("1 0 5\n2 0 3\n3 0 8\n4 0 1");
+    ReadyQueue fifo(ReadyOrder::FIFO);
+    fifo.attach(procs);
+    fifo.admit_arrivals(0);
+    assert_equal(4, fifo.steal()->pid, "FIFO steal takes the newest entry");
+    assert_equal(1, fifo.pop()->pid, "Owner still pops the oldest entry");
+    
+    ReadyQueue shortest(ReadyOrder::SHORTEST_BURST);
+    shortest.attach(procs);
+    shortest.admit_arrivals(0);
+    Process* stolen = shortest.steal();
+    assert_equal(1, stolen->pid != 4 ? 1 : 0, "Heap steal leaves the best job");
+    assert_equal(4, shortest.pop()->pid, "Heap order intact after steal");
+    
+    // Heavy-tailed bursts leave some per-CPU queues long while others drain
+    WorkloadSpec spec;
+    spec.count = 600;
+    spec.seed = 3;
+    spec.arrival_rate = 0.35;
+    spec.set_burst("pareto:1.3:2");
+    spec.max_burst = 500;
+    std::vector<Process> workload = WorkloadGenerator(spec).generate();
+    
+    std::unique_ptr<SMPScheduler> pinned(create_smp_scheduler("rr", 4, DispatchMode::PER_CPU));
+    pinned->load_processes(workload);
+    pinned->schedule();
+    std::unique_ptr<SMPScheduler> stealing(create_smp_scheduler("rr", 4, DispatchMode::PER_CPU));
+    stealing->set_steal_policy(StealPolicy::BUSIEST);
+    stealing->load_processes(workload);
+    stealing->schedule();
+    
+    PerformanceMetrics pinned_metrics(pinned->get_processes(), pinned->get_cpu_gantt_charts());
+    PerformanceMetrics stealing_metrics(stealing->get_processes(), stealing->get_cpu_gantt_charts());
+    
+    assert_equal(0, (int)pinned->get_migration_count(), "No migrations without stealing");
+    assert_equal(1, stealing->get_steal_count() > 0 ? 1 : 0, "Idle CPUs steal work");
+    assert_equal(1, stealing->get_migration_count() <= stealing->get_steal_count() ? 1 : 0,
+                 "Migrations only come from steals in per-CPU mode");
+    assert_equal(1, stealing_metrics.calculate_load_imbalance() <= pinned_metrics.calculate_load_imbalance() ? 1 : 0,
+                 "Stealing does not worsen imbalance");
+    assert_equal(0, stealing->remaining_count(), "All jobs complete with stealing");
+    
+    // Random stealing is reproducible for a fixed seed
+    std::unique_ptr<SMPScheduler> random_a(create_smp_scheduler("stcf", 4, DispatchMode::PER_CPU));
+    std::unique_ptr<SMPScheduler> random_b(create_smp_scheduler("stcf", 4, DispatchMode::PER_CPU));
+    random_a->set_steal_policy(StealPolicy::RANDOM, 99);
+    random_b->set_steal_policy(StealPolicy::RANDOM, 99);
+    random_a->load_processes(workload);
+    random_b->load_processes(workload);
+    random_a->schedule();
+    random_b->schedule();
+    PerformanceMetrics metrics_a(random_a->get_processes(), random_a->get_cpu_gantt_charts());
+    PerformanceMetrics metrics_b(random_b->get_processes(), random_b->get_cpu_gantt_charts());
+    assert_equal(metrics_a.calculate_average_waiting_time(), metrics_b.calculate_average_waiting_time(),
+                 "Seeded random stealing is reproducible");
+}
+
+// Orders heap ids by an external key array (for the IndexedHeap test)
+struct KeyLess {
+    const std::vector<int>* keys;
+    
+    explicit KeyLess(const std::vector<int>* keys = nullptr) : keys(keys) {}
+    bool operator()(size_t a, size_t b) const { return (*keys)[a] < (*keys)[b]; }
+};
+
+void test_priority_scheduler() {
+    std::cout << "\n=== Testing Priority Scheduler ===\n";
+    
+    // Keys can change in place and the heap is repaired with update()
+    std::vector<int> keys = {50, 40, 30, 20, 10};
+    IndexedHeap<KeyLess> heap((KeyLess(&keys)));
+    heap.reset(keys.size());
+    for (size_t id = 0; id < keys.size(); id++) {
+        heap.push(id);
+    }
+    assert_equal(4, (int)heap.top(), "IndexedHeap top is the smallest key");
+    keys[0] = 5;
+    heap.update(0);
+    assert_equal(0, (int)heap.top(), "IndexedHeap update moves an id up");
+    keys[0] = 60;
+    heap.update(0);
+    heap.erase(3);
+    assert_equal(4, (int)heap.pop(), "IndexedHeap update moves an id down");
+    assert_equal(2, (int)heap.pop(), "IndexedHeap erase removes an id");
+    assert_equal(1, (int)heap.pop(), "IndexedHeap pop order");
+    assert_equal(0, (int)heap.pop(), "IndexedHeap last id");
+    assert_equal(true, heap.empty(), "IndexedHeap empty after pops");
+    
+    std::string test_data = "1 0 10 3\n2 1 4 1\n3 2 6 2\n4 3 2 1\n5 5 3 2";
+    
+    std::unique_ptr<Scheduler> preemptive(create_priority_scheduler(true, 0));
+    preemptive->load_processes(FileParser::parse_string(test_data));
+    preemptive->schedule();
+    const auto& procs = preemptive->get_processes();
+    assert_equal(25, procs[0].completion_time, "Preemptive priority P1 completion (preempted)");
+    assert_equal(5, procs[1].completion_time, "Preemptive priority P2 completion");
+    assert_equal(7, procs[3].completion_time, "Preemptive priority P4 completion");
+    assert_equal(16, procs[4].completion_time, "Preemptive priority P5 completion");
+    
+    // Without aging P4 (priority 1) beats P3 (priority 2); with aging both
+    // reach the floor while P2 runs and P3 wins on its earlier arrival
+    std::unique_ptr<Scheduler> plain(create_priority_scheduler(false, 0));
+    plain->load_processes(FileParser::parse_string(test_data));
+    plain->schedule();
+    assert_equal(22, plain->get_processes()[2].completion_time, "Priority P3 completion without aging");
+    std::unique_ptr<Scheduler> aged(create_priority_scheduler(false, 3));
+    aged->load_processes(FileParser::parse_string(test_data));
+    aged->schedule();
+    assert_equal(20, aged->get_processes()[2].completion_time, "Priority P3 completion with aging");
+    assert_equal(true, aged->get_gantt_chart().is_valid(), "Priority Gantt chart is contiguous");
+    
+    // A steady stream of urgent jobs starves a low-priority one unless it ages
+    std::ostringstream stream;
+    stream << "1 1 3 5\n";
+    for (int i = 0; i < 100; i++) {
+        stream << (i + 2) << " " << 2 * i << " 2 1\n";
+    }
+    std::unique_ptr<Scheduler> starving(create_priority_scheduler(true, 0));
+    starving->load_processes(FileParser::parse_string(stream.str()));
+    starving->schedule();
+    std::unique_ptr<Scheduler> aging(create_priority_scheduler(true, 10));
+    aging->load_processes(FileParser::parse_string(stream.str()));
+    aging->schedule();
+    auto low_priority = [](const Scheduler& s) {
+        const auto& all = s.get_processes();
+        return std::find_if(all.begin(), all.end(), [](const Process& p) { return p.pid == 1; })->completion_time;
+    };
+    assert_equal(203, low_priority(*starving), "Low priority job starves without aging");
+    assert_equal(1, low_priority(*aging) < 100 ? 1 : 0, "Aging lets the low priority job run");
+    assert_equal(0, aging->remaining_count(), "All jobs complete with aging");
+}
+
+void test_mlfq_scheduler() {
+    std::cout << "\n=== Testing MLFQ Scheduler ===\n";
+    
+    // Default quanta 2,4,8: the short jobs finish at the top level
+    std::unique_ptr<Scheduler> mlfq(create_scheduler("mlfq"));
+    mlfq->load_processes(FileParser::parse_string("1 0 4\n2 1 2\n3 2 6\n4 3 3\n5 4 1"));
+    mlfq->schedule();
+    const auto& procs = mlfq->get_processes();
+    assert_equal(4, procs[1].completion_time, "MLFQ P2 completes in its first quantum");
+    assert_equal(9, procs[4].completion_time, "MLFQ P5 completes in its first quantum");
+    assert_equal(15, procs[2].completion_time, "MLFQ P3 completion after demotion");
+    assert_equal(true, mlfq->get_gantt_chart().is_valid(), "MLFQ Gantt chart is contiguous");
+    
+    // An arrival preempts a demoted job, which keeps the rest of its allotment
+    std::unique_ptr<Scheduler> preempted(create_mlfq_scheduler(std::vector<int>{2, 4, 8}, 0));
+    preempted->load_processes(FileParser::parse_string("1 0 10\n2 5 2"));
+    preempted->schedule();
+    assert_equal(7, preempted->get_processes()[1].completion_time, "MLFQ arrival preempts a lower level");
+    assert_equal(12, preempted->get_processes()[0].completion_time, "MLFQ preempted job completion");
+    PerformanceMetrics metrics(preempted->get_processes(), preempted->get_gantt_chart());
+    assert_equal(2, metrics.calculate_context_switches(), "MLFQ context switches");
+    
+    // A single level is Round Robin
+    std::string rr_data = "1 0 4\n2 1 2\n3 2 6\n4 3 3\n5 4 1";
+    std::unique_ptr<Scheduler> single(create_mlfq_scheduler(std::vector<int>{2}, 0));
+    std::unique_ptr<Scheduler> rr(create_scheduler("rr"));
+    single->load_processes(FileParser::parse_string(rr_data));
+    rr->load_processes(FileParser::parse_string(rr_data));
+    single->schedule();
+    rr->schedule();
+    PerformanceMetrics single_metrics(single->get_processes(), single->get_gantt_chart());
+    PerformanceMetrics rr_metrics(rr->get_processes(), rr->get_gantt_chart());
+    assert_equal(rr_metrics.calculate_average_waiting_time(), single_metrics.calculate_average_waiting_time(),
+                 "One-level MLFQ matches RR");
+    
+    // Short jobs arriving every time unit starve the demoted job until a boost
+    std::ostringstream stream;
+    stream << "1 0 10\n";
+    for (int i = 1; i <= 100; i++) {
+        stream << (i + 1) << " " << i << " 1\n";
+    }
+    std::unique_ptr<Scheduler> starving(create_mlfq_scheduler(std::vector<int>{1, 4}, 0));
+    starving->load_processes(FileParser::parse_string(stream.str()));
+    starving->schedule();
+    std::unique_ptr<Scheduler> boosted(create_mlfq_scheduler(std::vector<int>{1, 4}, 10));
+    boosted->load_processes(FileParser::parse_string(stream.str()));
+    boosted->schedule();
+    assert_equal(110, starving->get_processes()[0].completion_time, "Demoted job starves without boost");
+    assert_equal(1, boosted->get_processes()[0].completion_time < 110 ? 1 : 0, "Priority boost lets it run");
+    assert_equal(0, boosted->remaining_count(), "All jobs complete with boost");
+    
+    bool rejected = false;
+    try {
+        std::unique_ptr<Scheduler> too_deep(create_mlfq_scheduler(std::vector<int>(65, 1), 0));
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    assert_equal(true, rejected, "MLFQ rejects more than 64 levels");
+}
+
+void test_cfs_scheduler() {
+    std::cout << "\n=== Testing CFS Scheduler ===\n";
+    
+    // Equal weights split each 20-unit period evenly
+    std::unique_ptr<Scheduler> equal(create_scheduler("cfs"));
+    equal->load_processes(FileParser::parse_string("1 0 20 0\n2 0 20 0"));
+    equal->schedule();
+    assert_equal(30, equal->get_processes()[0].completion_time, "CFS equal weights P1 completion");
+    assert_equal(40, equal->get_processes()[1].completion_time, "CFS equal weights P2 completion");
+    PerformanceMetrics equal_metrics(equal->get_processes(), equal->get_gantt_chart());
+    assert_equal(3, equal_metrics.calculate_context_switches(), "CFS slices are target_latency / 2");
+    
+    // Nice 0 (weight 1024) against nice 5 (weight 335): the heavier job gets
+    // about three times the CPU while both are runnable
+    std::unique_ptr<Scheduler> weighted(create_scheduler("cfs"));
+    weighted->load_processes(FileParser::parse_string("1 0 40 0\n2 0 40 5"));
+    weighted->schedule();
+    assert_equal(52, weighted->get_processes()[0].completion_time, "CFS nice 0 job finishes first");
+    assert_equal(80, weighted->get_processes()[1].completion_time, "CFS nice 5 job finishes last");
+    assert_equal(15, weighted->get_processes()[1].start_time, "CFS nice 0 job gets the larger first slice");
+    
+    // A new job far behind the running one in vruntime preempts it
+    std::unique_ptr<Scheduler> preempt(create_scheduler("cfs"));
+    preempt->load_processes(FileParser::parse_string("1 0 10 3\n2 1 4 1\n3 2 6 2\n4 3 2 1\n5 5 3 2"));
+    preempt->schedule();
+    assert_equal(3, preempt->get_processes()[1].start_time, "CFS arrival preempts after the wakeup granularity");
+    assert_equal(true, preempt->get_gantt_chart().is_valid(), "CFS Gantt chart is contiguous");
+    
+    // Longer latency and granularity mean fewer, longer slices
+    std::unique_ptr<Scheduler> coarse(create_cfs_scheduler(40, 4));
+    coarse->load_processes(FileParser::parse_string("1 0 20 0\n2 0 20 0"));
+    coarse->schedule();
+    PerformanceMetrics coarse_metrics(coarse->get_processes(), coarse->get_gantt_chart());
+    assert_equal(1, coarse_metrics.calculate_context_switches(), "CFS target latency sets the period");
+}
+
+void test_proportional_share() {
+    std::cout << "\n=== Testing Lottery and Stride Schedulers ===\n";
+    
+    assert_equal(100, share_tickets(0), "Priority 0 holds 100 tickets");
+    assert_equal(25, share_tickets(3), "Priority 3 holds 25 tickets");
+    assert_equal(1, share_tickets(100), "Low priorities keep one ticket");
+    
+    // A job of priority >= 100 still gets the CPU, alone or against another job
+    const char* share_algorithms[] = {"lottery", "stride"};
+    for (const char* algorithm : share_algorithms) {
+        std::unique_ptr<Scheduler> starved(create_scheduler(algorithm));
+        starved->load_processes(FileParser::parse_string("1 0 5 100\n2 0 5 0"));
+        starved->schedule();
+        std::unique_ptr<Scheduler> alone(create_scheduler(algorithm));
+        alone->load_processes(FileParser::parse_string("1 0 5 500"));
+        alone->schedule();
+        assert_equal(true, starved->remaining_count() == 0 && alone->remaining_count() == 0 &&
+                           alone->get_processes()[0].completion_time == 5,
+                     std::string(algorithm) + " runs priority 100+ jobs");
+    }
+    
+    // Stride with 100 vs 50 tickets: A runs twice for each run of B
+    std::string pair_data = "1 0 30 0\n2 0 30 1";
+    std::unique_ptr<Scheduler> stride(create_stride_scheduler(1));
+    stride->load_processes(FileParser::parse_string(pair_data));
+    stride->schedule();
+    assert_equal(44, stride->get_processes()[0].completion_time, "Stride gives A two thirds of the CPU");
+    assert_equal(60, stride->get_processes()[1].completion_time, "Stride B completion");
+    
+    PerformanceMetrics stride_metrics(stride->get_processes(), stride->get_gantt_chart());
+    std::vector<ShareRecord> shares = stride_metrics.calculate_shares();
+    assert_equal(2, (int)shares.size(), "One share record per completed process");
+    assert_equal(44.0 * 2 / 3, shares[0].entitled, "A is entitled to 2/3 of its 44-unit lifetime");
+    assert_equal(1, std::abs(shares[0].ratio() - 1.0) < 0.05 ? 1 : 0, "Stride A receives its entitled share");
+    assert_equal(60.0, shares[0].entitled + shares[1].entitled, "Entitlements add up to the busy time");
+    
+    // Entitlement only accrues while a job is runnable and the CPU is busy:
+    // P1 is in I/O over 2-12 and the CPU idles over 6-12
+    std::unique_ptr<Scheduler> io_stride(create_stride_scheduler(2));
+    io_stride->load_processes(FileParser::parse_string("1 0 2,10,2 0\n2 0 4 0"));
+    io_stride->schedule();
+    std::vector<ShareRecord> io_shares =
+        PerformanceMetrics(io_stride->get_processes(), io_stride->get_gantt_chart()).calculate_shares();
+    assert_equal(3.0, io_shares[0].entitled, "I/O job is not entitled while blocked");
+    assert_equal(5.0, io_shares[1].entitled, "CPU job is entitled to the CPU alone while P1 blocks");
+    
+    // A job that blocks after 1 of its 4-unit quantum is charged a quarter
+    // stride, so it runs again before both CPU-bound jobs have had a turn
+    std::unique_ptr<Scheduler> partial(create_stride_scheduler(4));
+    partial->load_processes(FileParser::parse_string("1 0 1,1,1,1,1,1,1,1,1,1,1 0\n2 0 40 0\n3 0 40 0"));
+    partial->schedule();
+    assert_equal(30, partial->get_processes()[0].completion_time, "Stride charges partial quanta pro rata");
+    
+    // Lottery with 100 vs 25 tickets gives roughly 4:1 while both run
+    std::string long_data = "1 0 4000 0\n2 0 4000 3";
+    std::unique_ptr<Scheduler> lottery(create_lottery_scheduler(1, 7));
+    lottery->load_processes(FileParser::parse_string(long_data));
+    lottery->schedule();
+    int b_service = lottery->get_processes()[0].completion_time - 4000;
+    assert_equal(1, b_service > 850 && b_service < 1150 ? 1 : 0, "Lottery splits the CPU by tickets");
+    assert_equal(0, lottery->remaining_count(), "Lottery completes every job");
+    
+    // A seed fully determines a lottery run
+    std::unique_ptr<Scheduler> again(create_lottery_scheduler(1, 7));
+    again->load_processes(FileParser::parse_string(long_data));
+    again->schedule();
+    assert_equal(lottery->get_processes()[0].completion_time, again->get_processes()[0].completion_time,
+                 "Seeded lottery is reproducible");
+    
+    // Stride tracks the entitlement more closely than lottery
+    WorkloadSpec spec;
+    spec.count = 300;
+    spec.seed = 5;
+    spec.arrival_rate = 0.2;
+    std::vector<Process> workload = WorkloadGenerator(spec).generate();
+    std::unique_ptr<Scheduler> share_stride(create_scheduler("stride"));
+    std::unique_ptr<Scheduler> share_lottery(create_scheduler("lottery"));
+    share_stride->load_processes(workload);
+    share_lottery->load_processes(workload);
+    share_stride->schedule();
+    share_lottery->schedule();
+    PerformanceMetrics stride_share(share_stride->get_processes(), share_stride->get_gantt_chart());
+    PerformanceMetrics lottery_share(share_lottery->get_processes(), share_lottery->get_gantt_chart());
+    assert_equal(1, stride_share.calculate_share_error() < lottery_share.calculate_share_error() ? 1 : 0,
+                 "Stride share error below lottery");
+}
+
+void test_edf_scheduler() {
+    std::cout << "\n=== Testing EDF Scheduler ===\n";
+    
+    // Deadline and period columns: "-" placeholders, implicit deadline = period
+    std::string timing_data = "1 0 3 0 Sensor 10 10\n2 5 5 0 - - 20\n3 0 2 0 Log -\n"
+                              "4 0 2 0 Bad 0\n5 1 2 0 Bad 4 -1\n6 2 1 0 Tail extra";
+    std::vector<Process> parsed = FileParser::parse_string(timing_data);
+    assert_equal(4, (int)parsed.size(), "Invalid deadline and period lines rejected");
+    assert_equal(10, parsed[0].deadline, "Deadline is relative to arrival");
+    assert_equal(10, parsed[0].period, "Period column");
+    assert_equal(25, parsed[1].deadline, "Periodic task defaults to a deadline of one period");
+    assert_equal("P2", parsed[1].name(), "Name placeholder keeps the default name");
+    assert_equal(false, parsed[2].has_deadline(), "Deadline placeholder means no deadline");
+    assert_equal(false, parsed[3].has_deadline(), "Trailing free text is not a deadline");
+    
+    ParseStats stats;
+    std::vector<Process> fast = FileParser::parse_buffer(timing_data.data(), timing_data.size(), &stats);
+    assert_equal(2, (int)stats.errors, "Fast parser rejects the same timing lines");
+    bool same = fast.size() == parsed.size();
+    for (size_t i = 0; same && i < fast.size(); i++) {
+        same = fast[i].pid == parsed[i].pid && fast[i].deadline == parsed[i].deadline &&
+               fast[i].period == parsed[i].period && fast[i].name() == parsed[i].name();
+    }
+    assert_equal(true, same, "Fast parser matches parse_string on timing columns");
+    
+    // Periodic releases get fresh PIDs in release order
+    std::vector<Process> tasks = FileParser::parse_string("1 0 3 0 A 10 10\n2 5 5 0 - - 20\n7 0 1");
+    std::vector<Process> jobs = FileParser::expand_periodic(tasks, 30);
+    assert_equal(6, (int)jobs.size(), "Periodic tasks expanded up to the horizon");
+    assert_equal(8, jobs[3].pid, "First extra release takes the next free PID");
+    assert_equal(10, jobs[3].arrival_time, "Release one period later");
+    assert_equal(20, jobs[3].deadline, "Deadline shifted with the release");
+    assert_equal(10, jobs[5].pid, "Releases numbered in time order");
+    assert_equal(45, jobs[5].deadline, "Implicit deadline shifted with the release");
+    assert_equal(0, jobs[0].period, "Expanded jobs are one-shot");
+    
+    // Binary version 2 keeps the timing columns
+    const std::string path = "edf_workload_test.bin";
+    BinaryWorkload::save(path, jobs);
+    std::vector<Process> loaded = BinaryWorkload::load(path);
+    assert_equal(45, loaded[5].deadline, "Binary round trip deadline");
+    assert_equal(-1, loaded[2].deadline, "Binary round trip without deadline");
+    
+    // A hand-written version 1 file loads without deadlines
+    {
+        std::ofstream out(path.c_str(), std::ios::binary);
+        auto put = [&out](uint64_t value, int bytes) {
+            for (int i = 0; i < bytes; i++) out.put(static_cast<char>((value >> (8 * i)) & 0xff));
+        };
+        out.write("SCHEDWKL", 8);
+        put(1, 4);                   // version
+        put(32, 4);                  // header size
+        put(1, 8);                   // count
+        put(0, 8);                   // name bytes
+        put(3, 4);                   // pid
+        put(2, 4);                   // arrival
+        put(5, 4);                   // burst
+        put(1, 4);                   // priority
+        put(0, 4);                   // name offsets
+        put(0, 4);
+    }
+    std::vector<Process> v1 = BinaryWorkload::load(path);
+    std::remove(path.c_str());
+    assert_equal(1, (int)v1.size(), "Version 1 file loads");
+    assert_equal(5, v1[0].burst_time, "Version 1 burst column");
+    assert_equal(false, v1[0].has_deadline(), "Version 1 jobs have no deadline");
+    
+    // The later arrival has the earlier deadline
+    std::string deadline_data = "1 0 10 0 - 30\n2 2 3 0 - 6";
+    std::unique_ptr<Scheduler> edf(create_scheduler("edf"));
+    edf->load_processes(FileParser::parse_string(deadline_data));
+    edf->schedule();
+    assert_equal(13, edf->get_processes()[0].completion_time, "Preemptive EDF P1 completion");
+    assert_equal(5, edf->get_processes()[1].completion_time, "Preemptive EDF runs P2 on arrival");
+    DeadlineStats met = PerformanceMetrics(edf->get_processes(), edf->get_gantt_chart()).calculate_deadline_stats();
+    assert_equal(2, met.jobs, "Jobs with deadlines");
+    assert_equal(0, met.missed, "Preemptive EDF meets both deadlines");
+    assert_equal(-3, met.max_lateness, "Max lateness is negative when every deadline is met");
+    
+    std::unique_ptr<Scheduler> edf_np(create_scheduler("edf-np"));
+    edf_np->load_processes(FileParser::parse_string(deadline_data));
+    edf_np->schedule();
+    assert_equal(13, edf_np->get_processes()[1].completion_time, "Non-preemptive EDF P2 waits for P1");
+    DeadlineStats late = PerformanceMetrics(edf_np->get_processes(), edf_np->get_gantt_chart()).calculate_deadline_stats();
+    assert_equal(1, late.missed, "Non-preemptive EDF misses P2");
+    assert_equal(0.5, late.miss_ratio, "Deadline miss ratio");
+    assert_equal(5, late.max_lateness, "Max lateness");
+    assert_equal(2.5, late.mean_tardiness, "Mean tardiness");
+    assert_equal(0, late.tardiness_p50, "Tardiness p50");
+    assert_equal(5, late.tardiness_p95, "Tardiness p95");
+    
+    // Jobs without a deadline run last
+    std::unique_ptr<Scheduler> mixed(create_scheduler("edf"));
+    mixed->load_processes(FileParser::parse_string("1 0 2\n2 0 2 0 - 5"));
+    mixed->schedule();
+    assert_equal(4, mixed->get_processes()[0].completion_time, "Job without deadline runs after");
+    assert_equal(2, mixed->get_processes()[1].completion_time, "Job with deadline runs first");
+    
+    // Global EDF on one CPU matches the single-CPU scheduler
+    std::unique_ptr<SMPScheduler> smp(create_smp_scheduler("edf", 1));
+    smp->load_processes(FileParser::parse_string(deadline_data));
+    smp->schedule();
+    assert_equal(5, smp->get_processes()[1].completion_time, "1-CPU global EDF matches EDF");
+}
+
+void test_io_bursts() {
+    std::cout << "\n=== Testing CPU/I/O Bursts ===\n";
+    
+    // Burst column: CPU and I/O alternate, starting and ending with CPU
+    std::string io_data = "1 0 2,3,4\n2 0 2,3\n3 0 2,0,1\n4 1 5";
+    std::vector<Process> parsed = FileParser::parse_string(io_data);
+    assert_equal(2, (int)parsed.size(), "Malformed burst sequences rejected");
+    assert_equal(6, parsed[0].burst_time, "Burst time is the CPU total");
+    assert_equal(3, parsed[0].io_time, "I/O total");
+    assert_equal(2, parsed[0].burst_left, "First CPU burst");
+    assert_equal(false, parsed[1].has_io(), "Plain burst has no I/O");
+    
+    ParseStats stats;
+    std::vector<Process> fast = FileParser::parse_buffer(io_data.data(), io_data.size(), &stats);
+    assert_equal(2, (int)stats.errors, "Fast parser rejects the same burst sequences");
+    assert_equal(true, fast.size() == 2 && fast[0].bursts_id == parsed[0].bursts_id &&
+                       fast[0].io_time == parsed[0].io_time, "Fast parser matches parse_string on bursts");
+    
+    // FCFS: P2 runs while P1 is in I/O, then P1 comes back behind it
+    std::unique_ptr<Scheduler> fcfs(create_scheduler("fcfs"));
+    fcfs->load_processes(FileParser::parse_string("1 0 2,3,2\n2 0 4"));
+    fcfs->schedule();
+    assert_equal(8, fcfs->get_processes()[0].completion_time, "Blocked job resumes after its I/O");
+    assert_equal(1, fcfs->get_processes()[0].waiting_time, "Waiting time excludes I/O");
+    assert_equal(1, (int)fcfs->get_gantt_chart().get_io_entries().size(), "I/O wait in the I/O lane");
+    PerformanceMetrics overlapped(fcfs->get_processes(), fcfs->get_gantt_chart());
+    assert_equal(100.0, overlapped.calculate_cpu_utilization(), "CPU busy during the I/O");
+    assert_equal(3, overlapped.get_total_io_time(), "Total I/O time");
+    assert_equal(100.0, overlapped.calculate_io_overlap(), "I/O fully overlapped");
+    
+    // Nothing else to run: the CPU idles through the I/O
+    std::unique_ptr<Scheduler> alone(create_scheduler("rr"));
+    alone->load_processes(FileParser::parse_string("1 0 2,5,1"));
+    alone->schedule();
+    PerformanceMetrics serial(alone->get_processes(), alone->get_gantt_chart());
+    assert_equal(37.5, serial.calculate_cpu_utilization(), "CPU idle during the only job's I/O");
+    assert_equal(0.0, serial.calculate_io_overlap(), "No overlap with one job");
+    assert_equal(0, alone->get_processes()[0].waiting_time, "No waiting with one job");
+    
+    // STCF: the wakeup preempts the longer job
+    std::unique_ptr<Scheduler> stcf(create_scheduler("stcf"));
+    stcf->load_processes(FileParser::parse_string("1 0 3,2,3\n2 1 10"));
+    stcf->schedule();
+    assert_equal(8, stcf->get_processes()[0].completion_time, "STCF wakeup preempts");
+    assert_equal(16, stcf->get_processes()[1].completion_time, "STCF long job completion");
+    
+    // MLFQ keeps a job that blocks before its quantum at the top level
+    std::unique_ptr<Scheduler> mlfq(create_mlfq_scheduler(std::vector<int>{2, 4, 8}, 0));
+    mlfq->load_processes(FileParser::parse_string("1 0 20\n2 0 1,3,1,3,1"));
+    mlfq->schedule();
+    assert_equal(11, mlfq->get_processes()[1].completion_time, "MLFQ favors the I/O-bound job");
+    
+    // Invariants on a mixed workload for every policy
+    std::ostringstream mixed;
+    unsigned seed = 12345;
+    for (int pid = 1; pid <= 40; pid++) {
+        mixed << pid << " " << (pid * 7) % 50 << " ";
+        seed = seed * 1103515245u + 12345u;
+        const int cpu_bursts = 1 + (seed >> 16) % 3;
+        for (int b = 0; b < cpu_bursts; b++) {
+            seed = seed * 1103515245u + 12345u;
+            if (b > 0) mixed << "," << 1 + (seed >> 20) % 8 << ",";
+            mixed << 1 + (seed >> 16) % 6;
+        }
+        mixed << " " << pid % 4 << "\n";
+    }
+    std::vector<Process> workload = FileParser::parse_string(mixed.str());
+    const char* algorithms[] = {"fcfs", "sjf", "stcf", "rr", "priority", "ppriority",
+                                "mlfq", "cfs", "lottery", "stride", "edf", "edf-np"};
+    for (const char* algorithm : algorithms) {
+        std::unique_ptr<Scheduler> scheduler(create_scheduler(algorithm));
+        scheduler->load_processes(workload);
+        scheduler->schedule();
+        
+        std::map<int, int> cpu_time;
+        for (const auto& entry : scheduler->get_gantt_chart()) {
+            if (!entry.is_idle()) cpu_time[entry.pid] += entry.duration();
+        }
+        bool consistent = scheduler->remaining_count() == 0;
+        int io_total = 0;
+        for (const auto& p : scheduler->get_processes()) {
+            io_total += p.io_time;
+            consistent = consistent && cpu_time[p.pid] == p.burst_time && p.waiting_time >= 0 &&
+                         p.turnaround_time == p.burst_time + p.io_time + p.waiting_time;
+        }
+        
+        // A job is never on the CPU during its own I/O
+        bool disjoint = true;
+        for (const auto& io : scheduler->get_gantt_chart().get_io_entries()) {
+            for (const auto& entry : scheduler->get_gantt_chart()) {
+                if (entry.pid == io.pid && entry.start_time < io.end_time && io.start_time < entry.end_time) {
+                    disjoint = false;
+                }
+            }
+        }
+        PerformanceMetrics metrics(scheduler->get_processes(), scheduler->get_gantt_chart());
+        assert_equal(true, consistent && disjoint && metrics.get_total_io_time() == io_total,
+                     std::string(algorithm) + " runs CPU/I/O jobs consistently");
+    }
+    
+    std::unique_ptr<SMPScheduler> smp(create_smp_scheduler("rr", 3));
+    smp->load_processes(workload);
+    smp->schedule();
+    bool smp_consistent = smp->remaining_count() == 0;
+    for (const auto& p : smp->get_processes()) {
+        smp_consistent = smp_consistent && p.turnaround_time == p.burst_time + p.io_time + p.waiting_time;
+    }
+    assert_equal(true, smp_consistent, "3-CPU RR runs CPU/I/O jobs consistently");
+}
+
+void test_scheduler_names() {
+    std::cout << "\n=== Testing Scheduler Names ===\n";
+    
+    bool all_known = true;
+    for (const std::string& name : scheduler_names()) {
+        try {
+            std::unique_ptr<Scheduler> scheduler(create_scheduler(name));
+        } catch (const std::runtime_error&) {
+            all_known = false;
+        }
+    }
+    assert_equal(12, (int)scheduler_names().size(), "One name per algorithm");
+    assert_equal(true, all_known, "create_scheduler accepts every listed name");
+}
+
+void test_switch_cost() {
+    std::cout << "\n=== Testing Context-Switch Cost ===\n";
+    
+    // RR (q=2), one unit per switch: CS P1 CS P2 CS P1
+    SwitchCost dispatch;
+    dispatch.dispatch = 1;
+    std::unique_ptr<Scheduler> rr(create_scheduler("rr"));
+    rr->set_switch_cost(dispatch);
+    rr->load_processes(FileParser::parse_string("1 0 4\n2 0 2"));
+    rr->schedule();
+    const GanttChart& chart = rr->get_gantt_chart();
+    const std::vector<GanttEntry>& entries = chart.get_entries();
+    assert_equal(6, (int)entries.size(), "Overhead slices in the chart");
+    assert_equal(true, entries[0].is_overhead() && entries[2].is_overhead() && entries[4].is_overhead(),
+                 "Overhead before every dispatch of a different job");
+    assert_equal(9, rr->get_processes()[0].completion_time, "Overhead advances the clock");
+    assert_equal(4, rr->get_processes()[1].response_time, "Overhead delays the response");
+    GanttSummary summary = chart.summarize();
+    assert_equal(3, summary.overhead_time, "Overhead time");
+    assert_equal(2, summary.context_switches, "Overhead slices are not switches themselves");
+    PerformanceMetrics metrics(rr->get_processes(), chart);
+    assert_equal(true, std::fabs(metrics.calculate_cpu_utilization() - 600.0 / 9) < 0.01,
+                 "Overhead is not useful CPU time");
+    assert_equal(3, metrics.get_overhead_time(), "Metrics report the overhead");
+    
+    // The online sink agrees with the chart
+    GanttMetricsSink sink;
+    rr->set_gantt_sink(&sink);
+    rr->reset_simulation();
+    rr->schedule();
+    assert_equal(summary.overhead_time, sink.summary().overhead_time, "Online overhead time");
+    assert_equal(summary.context_switches, sink.summary().context_switches, "Online switches with overhead");
+    assert_equal((int)summary.slices, (int)sink.summary().slices, "Online slices with overhead");
+    
+    // A job that keeps the CPU pays once
+    std::unique_ptr<Scheduler> alone(create_scheduler("rr"));
+    alone->set_switch_cost(dispatch);
+    alone->load_processes(FileParser::parse_string("1 0 6"));
+    alone->schedule();
+    assert_equal(7, alone->get_processes()[0].completion_time, "No switch back to the same job");
+    
+    // Cache warmup: full penalty when cold, 4 * 6 / 8 = 3 after 6 units away
+    SwitchCost cache;
+    cache.cache_penalty = 4;
+    cache.cache_decay = 8;
+    assert_equal(3, cache.warmup(6), "Partial warmup");
+    assert_equal(4, cache.warmup(-1), "Never ran: cold cache");
+    std::unique_ptr<Scheduler> warm(create_scheduler("rr"));
+    warm->set_switch_cost(cache);
+    warm->load_processes(FileParser::parse_string("1 0 4\n2 0 2"));
+    warm->schedule();
+    assert_equal(17, warm->get_processes()[0].completion_time, "Warmup depends on time descheduled");
+    
+    // FCFS: P1's I/O (3-6) overlaps the switch to P2 (3-4), then P2 (4-6)
+    std::unique_ptr<Scheduler> io(create_scheduler("fcfs"));
+    io->set_switch_cost(dispatch);
+    io->load_processes(FileParser::parse_string("1 0 2,3,2\n2 0 4"));
+    io->schedule();
+    PerformanceMetrics io_metrics(io->get_processes(), io->get_gantt_chart());
+    assert_equal(true, std::fabs(io_metrics.calculate_io_overlap() - 200.0 / 3) < 0.01,
+                 "Switch overhead does not overlap I/O");
+    
+    bool rejected = false;
+    try {
+        SwitchCost bad;
+        bad.cache_decay = 0;
+        warm->set_switch_cost(bad);
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    assert_equal(true, rejected, "Cache decay must be positive");
+}
+
 int main() {
     std::cout << "Running CPU Scheduler Tests...\n";
     
     test_process_creation();
     test_process_metrics();
     test_file_parser();
+    test_fast_parser();
+    test_parallel_parser();
+    test_binary_workload();
     test_gantt_chart();
+    test_gantt_coalescing();
+    test_gantt_metrics_sink();
+    test_process_table();
+    test_stcf_scheduler();
+    test_sparse_pids();
+    test_ready_queue();
+    test_compare_algorithms();
+    test_quantum_sweep();
+    test_workload_generator();
+    test_smp_scheduler();
+    test_work_stealing();
+    test_priority_scheduler();
+    test_mlfq_scheduler();
+    test_cfs_scheduler();
+    test_proportional_share();
+    test_edf_scheduler();
+    test_io_bursts();
+    test_switch_cost();
+    test_scheduler_names();
     
     std::cout << "\n=== Test Results ===\n";
     std::cout << "Tests passed: " << tests_passed << "\n";